@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "checkpoint.h"
+
+
+#define CHECKPOINT_MAGIC 0x4B435446 // "FTCK"
+
+static const char *sCheckpointKindNames[CHECKPOINT_KIND_COUNT] = { "sweep", "beam", "mcts", "tune" };
+
+struct CheckpointHeader
+{
+    u32 magic;
+    u32 version;
+    s32 kind;
+    u32 pad;
+    u64 config;
+};
+
+u64 checkpoint_hash(u64 hash, const void *data, size_t size) {
+    const u8 *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+f64 checkpoint_clock(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+s32 checkpoint_due(const struct CheckpointOptions *options, f64 *last) {
+    if (options->path == NULL) {
+        return FALSE;
+    }
+    f64 now = checkpoint_clock();
+    if (now - *last < options->seconds) {
+        return FALSE;
+    }
+    *last = now;
+    return TRUE;
+}
+
+void checkpoint_begin(struct CheckpointWriter *w, const char *path, s32 kind, u64 config) {
+    w->path = path;
+    w->tmpPath = malloc(strlen(path) + 5);
+    if (w->tmpPath == NULL) {
+        printf("Failed to allocate a checkpoint path\n");
+        exit(1);
+    }
+    sprintf(w->tmpPath, "%s.tmp", path);
+
+    w->f = fopen(w->tmpPath, "wb");
+    if (w->f == NULL) {
+        printf("Failed to open %s\n", w->tmpPath);
+        exit(1);
+    }
+    w->checksum = CHECKPOINT_HASH_INIT;
+
+    struct CheckpointHeader header = { CHECKPOINT_MAGIC, CHECKPOINT_VERSION, kind, 0, config };
+    checkpoint_write(w, &header, sizeof(header));
+}
+
+void checkpoint_write(struct CheckpointWriter *w, const void *data, size_t size) {
+    if (size > 0 && fwrite(data, size, 1, w->f) != 1) {
+        printf("Failed to write %s\n", w->tmpPath);
+        exit(1);
+    }
+    w->checksum = checkpoint_hash(w->checksum, data, size);
+}
+
+void checkpoint_end(struct CheckpointWriter *w) {
+    u64 checksum = w->checksum;
+    checkpoint_write(w, &checksum, sizeof(checksum));
+
+    // On disk before the rename, or a crash could leave an empty file behind it
+    if (fflush(w->f) != 0 || fsync(fileno(w->f)) != 0 || fclose(w->f) != 0) {
+        printf("Failed to write %s\n", w->tmpPath);
+        exit(1);
+    }
+    if (rename(w->tmpPath, w->path) != 0) {
+        printf("Failed to rename %s to %s\n", w->tmpPath, w->path);
+        exit(1);
+    }
+    free(w->tmpPath);
+    w->tmpPath = NULL;
+    w->f = NULL;
+}
+
+s32 checkpoint_open(struct CheckpointReader *r, const char *path, s32 kind, u64 config) {
+    r->path = path;
+    r->f = fopen(path, "rb");
+    if (r->f == NULL) {
+        return FALSE;
+    }
+    r->checksum = CHECKPOINT_HASH_INIT;
+
+    struct CheckpointHeader header;
+    checkpoint_read(r, &header, sizeof(header));
+    if (header.magic != CHECKPOINT_MAGIC) {
+        printf("%s is not a checkpoint\n", path);
+        exit(1);
+    }
+    if (header.version != CHECKPOINT_VERSION) {
+        printf("%s is a version %u checkpoint, expected version %d\n", path, header.version, CHECKPOINT_VERSION);
+        exit(1);
+    }
+    if (header.kind != kind) {
+        printf("%s is a %s checkpoint, not a %s one\n", path,
+            header.kind >= 0 && header.kind < CHECKPOINT_KIND_COUNT ? sCheckpointKindNames[header.kind] : "unknown",
+            sCheckpointKindNames[kind]);
+        exit(1);
+    }
+    if (header.config != config) {
+        printf("%s was saved by a %s with different options or inputs\n", path, sCheckpointKindNames[kind]);
+        exit(1);
+    }
+    return TRUE;
+}
+
+void checkpoint_read(struct CheckpointReader *r, void *data, size_t size) {
+    if (size > 0 && fread(data, size, 1, r->f) != 1) {
+        printf("%s is truncated\n", r->path);
+        exit(1);
+    }
+    r->checksum = checkpoint_hash(r->checksum, data, size);
+}
+
+void checkpoint_close(struct CheckpointReader *r) {
+    u64 expected = r->checksum;
+    u64 checksum;
+    checkpoint_read(r, &checksum, sizeof(checksum));
+    if (checksum != expected || fgetc(r->f) != EOF) {
+        printf("%s is corrupt\n", r->path);
+        exit(1);
+    }
+    fclose(r->f);
+    r->f = NULL;
+}
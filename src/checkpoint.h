@@ -0,0 +1,74 @@
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "math_util.h"
+
+
+// Bumped whenever the layout of any checkpoint changes
+#define CHECKPOINT_VERSION 3
+
+enum CheckpointKind
+{
+    CHECKPOINT_SWEEP,
+    CHECKPOINT_BEAM,
+    CHECKPOINT_MCTS,
+    CHECKPOINT_TUNE,
+    CHECKPOINT_KIND_COUNT,
+};
+
+struct CheckpointOptions
+{
+    // File to resume from if it exists and to save to, or NULL for none
+    const char *path;
+    // Minimum wall time between saves
+    f64 seconds;
+};
+
+/**
+ * Checkpoints are native-endian binary: a header with the kind, version and a
+ * hash of whatever the search was started with, the searcher's own fields, and
+ * a checksum of everything before it. They're written to <path>.tmp and renamed
+ * over path, so a crash while saving leaves the previous checkpoint intact.
+ */
+struct CheckpointWriter
+{
+    FILE *f;
+    const char *path;
+    char *tmpPath;
+    u64 checksum;
+};
+
+struct CheckpointReader
+{
+    FILE *f;
+    const char *path;
+    u64 checksum;
+};
+
+// FNV-1a, chained through hash. Start from CHECKPOINT_HASH_INIT.
+#define CHECKPOINT_HASH_INIT 0xCBF29CE484222325ull
+u64 checkpoint_hash(u64 hash, const void *data, size_t size);
+
+// Whether a save is due, given when the last one was made. Updates last if so.
+s32 checkpoint_due(const struct CheckpointOptions *options, f64 *last);
+f64 checkpoint_clock(void);
+
+void checkpoint_begin(struct CheckpointWriter *w, const char *path, s32 kind, u64 config);
+void checkpoint_write(struct CheckpointWriter *w, const void *data, size_t size);
+void checkpoint_end(struct CheckpointWriter *w);
+
+/**
+ * Returns FALSE if there is no checkpoint at path. Exits after printing an
+ * error if there is one but it has the wrong kind or version, or was written
+ * for a different config.
+ */
+s32 checkpoint_open(struct CheckpointReader *r, const char *path, s32 kind, u64 config);
+// Exits after printing an error if the file is short
+void checkpoint_read(struct CheckpointReader *r, void *data, size_t size);
+// Exits after printing an error if the checksum doesn't match
+void checkpoint_close(struct CheckpointReader *r);
+
+#endif
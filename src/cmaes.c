@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmaes.h"
+
+
+// Follows the (mu/mu_w, lambda) CMA-ES in Hansen's "The CMA Evolution Strategy: A Tutorial"
+
+static void *cmaes_alloc(size_t size) {
+    void *p = calloc(1, max(size, 1));
+    if (p == NULL) {
+        printf("Failed to allocate %zu bytes for CMA-ES\n", size);
+        exit(1);
+    }
+    return p;
+}
+
+// xorshift64*, mapped to (0, 1]
+static f64 uniform(struct Cmaes *c) {
+    c->seed ^= c->seed >> 12;
+    c->seed ^= c->seed << 25;
+    c->seed ^= c->seed >> 27;
+    return ((c->seed * 0x2545F4914F6CDD1Dull >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+// Box-Muller
+static f64 normal(struct Cmaes *c) {
+    f64 u = uniform(c);
+    f64 v = uniform(c);
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+/**
+ * Eigendecomposition of the symmetric matrix a (destroyed) by cyclic Jacobi
+ * rotations. Eigenvectors go in the columns of v, eigenvalues in d. Fine for
+ * the handful of dimensions this is used with.
+ */
+static void symmetric_eigen(f64 *a, f64 *v, f64 *d, s32 n) {
+    for (s32 i = 0; i < n; i++) {
+        for (s32 j = 0; j < n; j++) {
+            v[i * n + j] = i == j;
+        }
+    }
+
+    for (s32 sweep = 0; sweep < 100; sweep++) {
+        f64 off = 0.0;
+        for (s32 p = 0; p < n; p++) {
+            for (s32 q = p + 1; q < n; q++) {
+                off += a[p * n + q] * a[p * n + q];
+            }
+        }
+        if (off < 1e-30) {
+            break;
+        }
+
+        for (s32 p = 0; p < n; p++) {
+            for (s32 q = p + 1; q < n; q++) {
+                f64 apq = a[p * n + q];
+                if (apq == 0.0) {
+                    continue;
+                }
+                f64 theta = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+                f64 t = (theta >= 0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                f64 cs = 1.0 / sqrt(t * t + 1.0);
+                f64 sn = t * cs;
+
+                for (s32 k = 0; k < n; k++) {
+                    f64 akp = a[k * n + p];
+                    f64 akq = a[k * n + q];
+                    a[k * n + p] = cs * akp - sn * akq;
+                    a[k * n + q] = sn * akp + cs * akq;
+                }
+                for (s32 k = 0; k < n; k++) {
+                    f64 apk = a[p * n + k];
+                    f64 aqk = a[q * n + k];
+                    a[p * n + k] = cs * apk - sn * aqk;
+                    a[q * n + k] = sn * apk + cs * aqk;
+                }
+                for (s32 k = 0; k < n; k++) {
+                    f64 vkp = v[k * n + p];
+                    f64 vkq = v[k * n + q];
+                    v[k * n + p] = cs * vkp - sn * vkq;
+                    v[k * n + q] = sn * vkp + cs * vkq;
+                }
+            }
+        }
+    }
+
+    for (s32 i = 0; i < n; i++) {
+        d[i] = a[i * n + i];
+    }
+}
+
+static void update_eigen(struct Cmaes *c) {
+    s32 n = c->n;
+    f64 *a = cmaes_alloc(n * n * sizeof(f64));
+
+    for (s32 i = 0; i < n; i++) {
+        for (s32 j = 0; j < n; j++) {
+            a[i * n + j] = (c->C[i * n + j] + c->C[j * n + i]) / 2;
+        }
+    }
+    symmetric_eigen(a, c->B, c->D, n);
+    for (s32 i = 0; i < n; i++) {
+        c->D[i] = sqrt(max(c->D[i], 1e-20));
+    }
+
+    c->eigenGeneration = c->generation;
+    free(a);
+}
+
+void cmaes_init(struct Cmaes *c, s32 n, s32 lambda, const f64 *mean, f64 sigma, u64 seed) {
+    memset(c, 0, sizeof(*c));
+    c->n = n;
+    c->lambda = lambda > 0 ? lambda : 4 + (s32) floor(3.0 * log(n));
+    c->mu = c->lambda / 2;
+    c->sigma = sigma;
+    c->seed = seed != 0 ? seed : 1;
+
+    c->weights = cmaes_alloc(c->mu * sizeof(f64));
+    f64 sum = 0.0;
+    for (s32 i = 0; i < c->mu; i++) {
+        c->weights[i] = log(c->mu + 0.5) - log(i + 1);
+        sum += c->weights[i];
+    }
+    f64 sumSquares = 0.0;
+    for (s32 i = 0; i < c->mu; i++) {
+        c->weights[i] /= sum;
+        sumSquares += c->weights[i] * c->weights[i];
+    }
+    c->mueff = 1.0 / sumSquares;
+
+    c->cc = (4.0 + c->mueff / n) / (n + 4.0 + 2.0 * c->mueff / n);
+    c->cs = (c->mueff + 2.0) / (n + c->mueff + 5.0);
+    c->c1 = 2.0 / ((n + 1.3) * (n + 1.3) + c->mueff);
+    c->cmu = min(1.0 - c->c1, 2.0 * (c->mueff - 2.0 + 1.0 / c->mueff) / ((n + 2.0) * (n + 2.0) + c->mueff));
+    c->damps = 1.0 + 2.0 * max(0.0, sqrt((c->mueff - 1.0) / (n + 1.0)) - 1.0) + c->cs;
+    c->chiN = sqrt(n) * (1.0 - 1.0 / (4.0 * n) + 1.0 / (21.0 * n * n));
+
+    c->mean = cmaes_alloc(n * sizeof(f64));
+    c->C = cmaes_alloc(n * n * sizeof(f64));
+    c->B = cmaes_alloc(n * n * sizeof(f64));
+    c->D = cmaes_alloc(n * sizeof(f64));
+    c->pc = cmaes_alloc(n * sizeof(f64));
+    c->ps = cmaes_alloc(n * sizeof(f64));
+    c->samples = cmaes_alloc(c->lambda * n * sizeof(f64));
+    c->z = cmaes_alloc(c->lambda * n * sizeof(f64));
+    c->order = cmaes_alloc(c->lambda * sizeof(s32));
+
+    memcpy(c->mean, mean, n * sizeof(f64));
+    for (s32 i = 0; i < n; i++) {
+        c->C[i * n + i] = 1.0;
+        c->B[i * n + i] = 1.0;
+        c->D[i] = 1.0;
+    }
+}
+
+void cmaes_free(struct Cmaes *c) {
+    free(c->weights);
+    free(c->mean);
+    free(c->C);
+    free(c->B);
+    free(c->D);
+    free(c->pc);
+    free(c->ps);
+    free(c->samples);
+    free(c->z);
+    free(c->order);
+    memset(c, 0, sizeof(*c));
+}
+
+void cmaes_sample(struct Cmaes *c) {
+    s32 n = c->n;
+
+    for (s32 k = 0; k < c->lambda; k++) {
+        f64 *z = &c->z[k * n];
+        f64 *x = &c->samples[k * n];
+        for (s32 i = 0; i < n; i++) {
+            z[i] = normal(c);
+        }
+        // x = mean + sigma * B * D * z
+        for (s32 i = 0; i < n; i++) {
+            f64 y = 0.0;
+            for (s32 j = 0; j < n; j++) {
+                y += c->B[i * n + j] * c->D[j] * z[j];
+            }
+            x[i] = c->mean[i] + c->sigma * y;
+        }
+    }
+}
+
+struct RankedSample
+{
+    f64 cost;
+    s32 index;
+};
+
+static int compare_ranked(const void *a, const void *b) {
+    const struct RankedSample *ra = a;
+    const struct RankedSample *rb = b;
+    if (ra->cost != rb->cost) {
+        return ra->cost < rb->cost ? -1 : 1;
+    }
+    return ra->index - rb->index;
+}
+
+void cmaes_update(struct Cmaes *c, const f64 *costs) {
+    s32 n = c->n;
+
+    struct RankedSample *ranked = cmaes_alloc(c->lambda * sizeof(struct RankedSample));
+    for (s32 k = 0; k < c->lambda; k++) {
+        ranked[k].cost = costs[k];
+        ranked[k].index = k;
+    }
+    qsort(ranked, c->lambda, sizeof(struct RankedSample), compare_ranked);
+    for (s32 k = 0; k < c->lambda; k++) {
+        c->order[k] = ranked[k].index;
+    }
+    free(ranked);
+
+    // New mean and the step it took, in units of sigma
+    f64 *yw = cmaes_alloc(n * sizeof(f64));
+    f64 *zw = cmaes_alloc(n * sizeof(f64));
+    for (s32 i = 0; i < c->mu; i++) {
+        const f64 *x = &c->samples[c->order[i] * n];
+        const f64 *z = &c->z[c->order[i] * n];
+        for (s32 j = 0; j < n; j++) {
+            yw[j] += c->weights[i] * (x[j] - c->mean[j]) / c->sigma;
+            zw[j] += c->weights[i] * z[j];
+        }
+    }
+    for (s32 j = 0; j < n; j++) {
+        c->mean[j] += c->sigma * yw[j];
+    }
+
+    // C^-1/2 * yw = B * zw, since every y is B * D * z
+    f64 psNorm = 0.0;
+    for (s32 i = 0; i < n; i++) {
+        f64 bz = 0.0;
+        for (s32 j = 0; j < n; j++) {
+            bz += c->B[i * n + j] * zw[j];
+        }
+        c->ps[i] = (1.0 - c->cs) * c->ps[i] + sqrt(c->cs * (2.0 - c->cs) * c->mueff) * bz;
+        psNorm += c->ps[i] * c->ps[i];
+    }
+    psNorm = sqrt(psNorm);
+
+    c->generation += 1;
+    s32 hsig = psNorm / sqrt(1.0 - pow(1.0 - c->cs, 2.0 * c->generation)) / c->chiN < 1.4 + 2.0 / (n + 1.0);
+    for (s32 i = 0; i < n; i++) {
+        c->pc[i] = (1.0 - c->cc) * c->pc[i] + hsig * sqrt(c->cc * (2.0 - c->cc) * c->mueff) * yw[i];
+    }
+
+    // Rank one update from the evolution path, rank mu update from the best samples.
+    // The samples' steps are relative to the old mean, which is mean - sigma * yw.
+    f64 decay = 1.0 - c->c1 - c->cmu + (1 - hsig) * c->c1 * c->cc * (2.0 - c->cc);
+    for (s32 i = 0; i < n; i++) {
+        for (s32 j = 0; j < n; j++) {
+            f64 rankMu = 0.0;
+            for (s32 k = 0; k < c->mu; k++) {
+                const f64 *x = &c->samples[c->order[k] * n];
+                f64 yi = (x[i] - c->mean[i]) / c->sigma + yw[i];
+                f64 yj = (x[j] - c->mean[j]) / c->sigma + yw[j];
+                rankMu += c->weights[k] * yi * yj;
+            }
+            c->C[i * n + j] = decay * c->C[i * n + j] + c->c1 * c->pc[i] * c->pc[j] + c->cmu * rankMu;
+        }
+    }
+
+    c->sigma *= exp(c->cs / c->damps * (psNorm / c->chiN - 1.0));
+
+    if (c->generation - c->eigenGeneration > c->lambda / (c->c1 + c->cmu) / n / 10.0) {
+        update_eigen(c);
+    }
+
+    free(yw);
+    free(zw);
+}
+
+void cmaes_save(const struct Cmaes *c, struct CheckpointWriter *w) {
+    s32 n = c->n;
+    checkpoint_write(w, &c->n, sizeof(c->n));
+    checkpoint_write(w, &c->lambda, sizeof(c->lambda));
+    checkpoint_write(w, c->mean, n * sizeof(f64));
+    checkpoint_write(w, &c->sigma, sizeof(c->sigma));
+    checkpoint_write(w, c->C, n * n * sizeof(f64));
+    checkpoint_write(w, c->B, n * n * sizeof(f64));
+    checkpoint_write(w, c->D, n * sizeof(f64));
+    checkpoint_write(w, c->pc, n * sizeof(f64));
+    checkpoint_write(w, c->ps, n * sizeof(f64));
+    checkpoint_write(w, &c->eigenGeneration, sizeof(c->eigenGeneration));
+    checkpoint_write(w, &c->generation, sizeof(c->generation));
+    checkpoint_write(w, &c->seed, sizeof(c->seed));
+}
+
+void cmaes_load(struct Cmaes *c, struct CheckpointReader *r) {
+    s32 n, lambda;
+    checkpoint_read(r, &n, sizeof(n));
+    checkpoint_read(r, &lambda, sizeof(lambda));
+    if (n != c->n || lambda != c->lambda) {
+        printf("%s has a CMA-ES state for n = %d, lambda = %d, not n = %d, lambda = %d\n", r->path, n, lambda,
+            c->n, c->lambda);
+        exit(1);
+    }
+
+    checkpoint_read(r, c->mean, n * sizeof(f64));
+    checkpoint_read(r, &c->sigma, sizeof(c->sigma));
+    checkpoint_read(r, c->C, n * n * sizeof(f64));
+    checkpoint_read(r, c->B, n * n * sizeof(f64));
+    checkpoint_read(r, c->D, n * sizeof(f64));
+    checkpoint_read(r, c->pc, n * sizeof(f64));
+    checkpoint_read(r, c->ps, n * sizeof(f64));
+    checkpoint_read(r, &c->eigenGeneration, sizeof(c->eigenGeneration));
+    checkpoint_read(r, &c->generation, sizeof(c->generation));
+    checkpoint_read(r, &c->seed, sizeof(c->seed));
+}
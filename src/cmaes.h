@@ -0,0 +1,65 @@
+#ifndef CMAES_H_
+#define CMAES_H_
+
+#include "checkpoint.h"
+#include "math_util.h"
+
+
+/**
+ * Covariance matrix adaptation evolution strategy, minimizing a function of n
+ * reals that is only known through its values. Each generation, sample a
+ * population with cmaes_sample, evaluate every member (in any order, on any
+ * thread) and hand the costs to cmaes_update.
+ */
+struct Cmaes
+{
+    s32 n;
+    s32 lambda;
+    s32 mu;
+    f64 *weights;
+    f64 mueff;
+
+    // Learning rates
+    f64 cc;
+    f64 cs;
+    f64 c1;
+    f64 cmu;
+    f64 damps;
+    // Expected length of an n dimensional standard normal vector
+    f64 chiN;
+
+    f64 *mean;
+    f64 sigma;
+    // Covariance C = B diag(D^2) B^T, with B and D refreshed from C every few generations
+    f64 *C;
+    f64 *B;
+    f64 *D;
+    f64 *pc;
+    f64 *ps;
+    s32 eigenGeneration;
+
+    // lambda rows of n: the population last sampled and the normal vectors behind it
+    f64 *samples;
+    f64 *z;
+    s32 *order;
+
+    s32 generation;
+    u64 seed;
+};
+
+// lambda <= 0 picks the default population size of 4 + 3 ln n
+void cmaes_init(struct Cmaes *c, s32 n, s32 lambda, const f64 *mean, f64 sigma, u64 seed);
+void cmaes_free(struct Cmaes *c);
+
+// Fills c->samples with a new population
+void cmaes_sample(struct Cmaes *c);
+
+// Moves the distribution toward the cheapest samples. costs has one entry per sample.
+void cmaes_update(struct Cmaes *c, const f64 *costs);
+
+// The distribution and RNG state between generations. Loading needs a c
+// initialized with the same n and lambda.
+void cmaes_save(const struct Cmaes *c, struct CheckpointWriter *w);
+void cmaes_load(struct Cmaes *c, struct CheckpointReader *r);
+
+#endif
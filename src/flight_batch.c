@@ -0,0 +1,218 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_batch.h"
+#include "flight_physics.h"
+
+
+void flight_batch_init(struct FlightBatch *b, s32 count)
+{
+    s32 capacity = (count + FLIGHT_BATCH_ALIGN - 1) / FLIGHT_BATCH_ALIGN * FLIGHT_BATCH_ALIGN;
+    if (capacity == 0)
+        capacity = FLIGHT_BATCH_ALIGN;
+
+    // One block: four f32 arrays followed by five s16 arrays, each at least 32 byte
+    // aligned so the SIMD kernels can use aligned loads
+    size_t f32Size = capacity * sizeof(f32);
+    size_t s16Size = capacity * sizeof(s16);
+    // aligned_alloc needs a size that is a multiple of the alignment
+    size_t totalSize = (4 * f32Size + 5 * s16Size + 63) / 64 * 64;
+    u8 *data = aligned_alloc(64, totalSize);
+    if (data == NULL) {
+        printf("Failed to allocate batch of %d states\n", count);
+        exit(1);
+    }
+    memset(data, 0, totalSize);
+
+    b->count = count;
+    b->capacity = capacity;
+
+    b->posY = (f32 *) data;
+    b->forwardVel = (f32 *) (data + f32Size);
+    b->stickX = (f32 *) (data + 2 * f32Size);
+    b->stickY = (f32 *) (data + 3 * f32Size);
+
+    u8 *s16Data = data + 4 * f32Size;
+    b->faceAngle[0] = (s16 *) s16Data;
+    b->faceAngle[1] = (s16 *) (s16Data + s16Size);
+    b->faceAngle[2] = (s16 *) (s16Data + 2 * s16Size);
+    b->angleVel[0] = (s16 *) (s16Data + 3 * s16Size);
+    b->angleVel[1] = (s16 *) (s16Data + 4 * s16Size);
+}
+
+void flight_batch_free(struct FlightBatch *b)
+{
+    free(b->posY);
+    memset(b, 0, sizeof(*b));
+}
+
+void flight_batch_view(struct FlightBatch *view, const struct FlightBatch *b, s32 start, s32 count)
+{
+    view->count = count;
+    view->capacity = b->capacity - start;
+
+    view->posY = b->posY + start;
+    view->forwardVel = b->forwardVel + start;
+    view->stickX = b->stickX + start;
+    view->stickY = b->stickY + start;
+    for (s32 i = 0; i < 3; i++)
+        view->faceAngle[i] = b->faceAngle[i] + start;
+    for (s32 i = 0; i < 2; i++)
+        view->angleVel[i] = b->angleVel[i] + start;
+}
+
+
+// Pitch and yaw vel come from the same helpers as update_flying, and the steps
+// after them mirror update_flying and act_flying in flight_physics.c expression
+// for expression, so that the float rounding is identical.
+
+void flight_batch_step_scalar(struct FlightBatch *b, s32 downTilt)
+{
+    f32 *restrict posY = b->posY;
+    f32 *restrict forwardVel = b->forwardVel;
+    s16 *restrict pitch = b->faceAngle[0];
+    s16 *restrict yaw = b->faceAngle[1];
+    s16 *restrict roll = b->faceAngle[2];
+    s16 *restrict pitchVel = b->angleVel[0];
+    s16 *restrict yawVel = b->angleVel[1];
+    const f32 *restrict stickX = b->stickX;
+    const f32 *restrict stickY = b->stickY;
+
+    for (s32 i = 0; i < b->count; i++) {
+        f32 speed = forwardVel[i];
+        s16 p = pitch[i];
+
+        s16 pv = flying_pitch_vel(pitchVel[i], stickY[i], speed);
+        s16 yv = flying_yaw_vel(yawVel[i], stickX[i], speed);
+        pitchVel[i] = pv;
+        yawVel[i] = yv;
+        yaw[i] += yv;
+        roll[i] = 20 * -yv;
+
+        speed -= pitch_drag(p);
+        speed -= 0.5f * (1.0f - coss(yv));
+
+        if (speed < 0.0f)
+            speed = 0.0f;
+
+        if (speed > 16.0f)
+            p += (speed - 32.0f) * 6.0f;
+        else if (speed > 4.0f)
+            p += (speed - 32.0f) * 10.0f;
+        else
+            p -= 0x400;
+
+        p += pv;
+
+        if (p > 0x2AAA)
+            p = 0x2AAA;
+        if (p < -0x2AAA)
+            p = -0x2AAA;
+
+        posY[i] += speed * sins(p);
+
+        if (downTilt) {
+            p -= 0x200;
+            if (p < -0x2AAA)
+                p = -0x2AAA;
+        }
+
+        forwardVel[i] = speed;
+        pitch[i] = p;
+    }
+}
+
+
+static const char *sKernelNames[] = { "scalar", "avx2", "avx512" };
+
+static void (*sKernel)(struct FlightBatch *b, s32 downTilt);
+static s32 sKernelId = -1;
+static pthread_once_t sKernelOnce = PTHREAD_ONCE_INIT;
+
+s32 flight_batch_kernel_supported(s32 kernel)
+{
+    switch (kernel) {
+    case FLIGHT_KERNEL_SCALAR:
+        return TRUE;
+#if FLIGHT_BATCH_X86
+    case FLIGHT_KERNEL_AVX2:
+        return __builtin_cpu_supports("avx2");
+    case FLIGHT_KERNEL_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return FALSE;
+    }
+}
+
+static void use_kernel(s32 kernel)
+{
+    switch (kernel) {
+#if FLIGHT_BATCH_X86
+    case FLIGHT_KERNEL_AVX2:
+        sKernel = flight_batch_step_avx2;
+        break;
+    case FLIGHT_KERNEL_AVX512:
+        sKernel = flight_batch_step_avx512;
+        break;
+#endif
+    default:
+        sKernel = flight_batch_step_scalar;
+        break;
+    }
+    sKernelId = kernel;
+}
+
+static void select_kernel(void)
+{
+    // FLIGHT_KERNEL=scalar|avx2|avx512 overrides the automatic choice
+    const char *forced = getenv("FLIGHT_KERNEL");
+    if (forced != NULL) {
+        for (s32 k = 0; k < FLIGHT_KERNEL_COUNT; k++) {
+            if (strcmp(forced, sKernelNames[k]) == 0 && flight_batch_kernel_supported(k)) {
+                use_kernel(k);
+                return;
+            }
+        }
+        printf("FLIGHT_KERNEL=%s is unknown or unsupported, picking automatically\n", forced);
+    }
+
+    for (s32 k = FLIGHT_KERNEL_COUNT - 1; k >= 0; k--) {
+        if (flight_batch_kernel_supported(k)) {
+            use_kernel(k);
+            return;
+        }
+    }
+}
+
+// Not thread safe, unlike the automatic choice
+s32 flight_batch_set_kernel(s32 kernel)
+{
+    pthread_once(&sKernelOnce, select_kernel);
+    if (!flight_batch_kernel_supported(kernel))
+        return FALSE;
+
+    use_kernel(kernel);
+    return TRUE;
+}
+
+s32 flight_batch_kernel(void)
+{
+    pthread_once(&sKernelOnce, select_kernel);
+    return sKernelId;
+}
+
+const char *flight_batch_kernel_name(s32 kernel)
+{
+    if (kernel < 0 || kernel >= FLIGHT_KERNEL_COUNT)
+        return "unknown";
+    return sKernelNames[kernel];
+}
+
+void flight_batch_step(struct FlightBatch *b, s32 downTilt)
+{
+    pthread_once(&sKernelOnce, select_kernel);
+    sKernel(b, downTilt);
+}
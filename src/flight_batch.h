@@ -0,0 +1,72 @@
+#ifndef FLIGHT_BATCH_H_
+#define FLIGHT_BATCH_H_
+
+#include "math_util.h"
+
+// Lanes are padded to a multiple of this so kernels never need a scalar tail.
+#define FLIGHT_BATCH_ALIGN 16
+
+/**
+ * Structure-of-arrays copy of the parts of MarioState that act_flying reads or
+ * writes. Lane i of every array together describes one state.
+ */
+struct FlightBatch
+{
+    s32 count;
+    s32 capacity;
+
+    f32 *posY;
+    f32 *forwardVel;
+    s16 *faceAngle[3];
+    s16 *angleVel[2];
+
+    f32 *stickX;
+    f32 *stickY;
+};
+
+void flight_batch_init(struct FlightBatch *b, s32 count);
+void flight_batch_free(struct FlightBatch *b);
+
+/**
+ * Points view at lanes [start, start + count) of b without copying, so that
+ * threads can step disjoint parts of one batch. start must be a multiple of
+ * FLIGHT_BATCH_ALIGN, and so must count unless the view ends at b->count,
+ * since kernels step the padding lanes after a view.
+ */
+void flight_batch_view(struct FlightBatch *view, const struct FlightBatch *b, s32 start, s32 count);
+
+/**
+ * Advance every lane by one frame, equivalent to calling act_flying on each.
+ * Sticks must already be in [-64, 64] as produced by adjust_analog_stick.
+ * Dispatches to the widest kernel the CPU supports; all kernels are bit exact.
+ */
+void flight_batch_step(struct FlightBatch *b, s32 downTilt);
+
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FLIGHT_BATCH_X86 1
+#else
+#define FLIGHT_BATCH_X86 0
+#endif
+
+enum FlightBatchKernel
+{
+    FLIGHT_KERNEL_SCALAR,
+    FLIGHT_KERNEL_AVX2,
+    FLIGHT_KERNEL_AVX512,
+    FLIGHT_KERNEL_COUNT,
+};
+
+s32 flight_batch_kernel_supported(s32 kernel);
+s32 flight_batch_set_kernel(s32 kernel);
+s32 flight_batch_kernel(void);
+const char *flight_batch_kernel_name(s32 kernel);
+
+// Individual kernels. The SIMD ones may step padding lanes past count.
+void flight_batch_step_scalar(struct FlightBatch *b, s32 downTilt);
+#if FLIGHT_BATCH_X86
+void flight_batch_step_avx2(struct FlightBatch *b, s32 downTilt);
+void flight_batch_step_avx512(struct FlightBatch *b, s32 downTilt);
+#endif
+
+#endif
@@ -0,0 +1,253 @@
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "flight_batch.h"
+
+#if FLIGHT_BATCH_X86
+
+// Vector versions of flight_batch_step_scalar. Each lane follows the scalar code
+// exactly:
+// - s16 values are widened to s32 lanes and wrapped back with wrap_s16 wherever
+//   the C code would truncate on assignment
+// - float to s16 conversion uses the same truncating cvttps2dq as the scalar code
+// - no_contract keeps a product from being fused into an FMA with the following
+//   add, which would change the rounding
+// - the speed clamp is a compare and blend rather than max, which would turn -0.0
+//   into +0.0
+
+#define AVX2_FN __attribute__((target("avx2")))
+#define AVX512_FN __attribute__((target("avx512f")))
+
+
+#define no_contract(v) __asm__("" : "+v"(v))
+
+AVX2_FN static inline __m256i wrap_s16_avx2(__m256i x)
+{
+    return _mm256_srai_epi32(_mm256_slli_epi32(x, 16), 16);
+}
+
+AVX2_FN static inline __m256i load_s16_avx2(const s16 *p)
+{
+    return _mm256_cvtepi16_epi32(_mm_load_si128((const __m128i *) p));
+}
+
+// x must already be wrapped, so saturation in packs never triggers
+AVX2_FN static inline void store_s16_avx2(s16 *p, __m256i x)
+{
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(x, x), 0x08);
+    _mm_store_si128((__m128i *) p, _mm256_castsi256_si128(packed));
+}
+
+AVX2_FN static inline __m256i approach_avx2(__m256i cur, __m256i target, s32 inc, s32 dec)
+{
+    __m256i up = _mm256_min_epi32(_mm256_add_epi32(cur, _mm256_set1_epi32(inc)), target);
+    __m256i down = _mm256_max_epi32(_mm256_sub_epi32(cur, _mm256_set1_epi32(dec)), target);
+    return _mm256_blendv_epi8(down, up, _mm256_cmpgt_epi32(target, cur));
+}
+
+// Shared shape of update_flying_pitch and update_flying_yaw. small is the clamp
+// after reversing direction (0x20 for pitch, 0x10 for yaw), and the target
+// velocity is approached with (small, 2 * small) toward the stick direction.
+AVX2_FN static inline __m256i angle_vel_avx2(__m256i vel, __m256 stick, __m256 speed,
+                                             f32 divisor, s32 small)
+{
+    __m256 scaled = _mm256_mul_ps(stick, _mm256_div_ps(speed, _mm256_set1_ps(divisor)));
+    __m256i target = wrap_s16_avx2(_mm256_sub_epi32(_mm256_setzero_si256(),
+                                                    wrap_s16_avx2(_mm256_cvttps_epi32(scaled))));
+    __m256i zero = _mm256_setzero_si256();
+
+    __m256i posFlip = _mm256_min_epi32(_mm256_add_epi32(vel, _mm256_set1_epi32(0x40)),
+                                       _mm256_set1_epi32(small));
+    __m256i posApproach = approach_avx2(vel, target, small, 2 * small);
+    __m256i pos = _mm256_blendv_epi8(posApproach, posFlip, _mm256_cmpgt_epi32(zero, vel));
+
+    __m256i negFlip = _mm256_max_epi32(_mm256_sub_epi32(vel, _mm256_set1_epi32(0x40)),
+                                       _mm256_set1_epi32(-small));
+    __m256i negApproach = approach_avx2(vel, target, 2 * small, small);
+    __m256i neg = _mm256_blendv_epi8(negApproach, negFlip, _mm256_cmpgt_epi32(vel, zero));
+
+    __m256i none = approach_avx2(vel, zero, 0x40, 0x40);
+
+    __m256i result = _mm256_blendv_epi8(none, neg, _mm256_cmpgt_epi32(zero, target));
+    return _mm256_blendv_epi8(result, pos, _mm256_cmpgt_epi32(target, zero));
+}
+
+AVX2_FN static inline __m256 sine_avx2(__m256i angle)
+{
+    __m256i index = _mm256_srli_epi32(_mm256_and_si256(angle, _mm256_set1_epi32(0xFFFF)), 4);
+    return _mm256_i32gather_ps(gSineTable, index, 4);
+}
+
+AVX2_FN void flight_batch_step_avx2(struct FlightBatch *b, s32 downTilt)
+{
+    const __m256i maxPitch = _mm256_set1_epi32(0x2AAA);
+    const __m256i minPitch = _mm256_set1_epi32(-0x2AAA);
+
+    for (s32 i = 0; i < b->count; i += 8) {
+        __m256 speed = _mm256_load_ps(&b->forwardVel[i]);
+        __m256i pitch = load_s16_avx2(&b->faceAngle[0][i]);
+        __m256i yaw = load_s16_avx2(&b->faceAngle[1][i]);
+
+        __m256i pitchVel = angle_vel_avx2(load_s16_avx2(&b->angleVel[0][i]),
+                                          _mm256_load_ps(&b->stickY[i]), speed, 5.0f, 0x20);
+        __m256i yawVel = angle_vel_avx2(load_s16_avx2(&b->angleVel[1][i]),
+                                        _mm256_load_ps(&b->stickX[i]), speed, 4.0f, 0x10);
+
+        store_s16_avx2(&b->angleVel[0][i], pitchVel);
+        store_s16_avx2(&b->angleVel[1][i], yawVel);
+        store_s16_avx2(&b->faceAngle[1][i], wrap_s16_avx2(_mm256_add_epi32(yaw, yawVel)));
+        store_s16_avx2(&b->faceAngle[2][i],
+                       wrap_s16_avx2(_mm256_mullo_epi32(yawVel, _mm256_set1_epi32(-20))));
+
+        // pitch_drag: scaling by a power of two is exact, so one multiply does
+        __m256 drag = _mm256_mul_ps(_mm256_cvtepi32_ps(pitch), _mm256_set1_ps(1.0f / 0x2000));
+        no_contract(drag);
+        speed = _mm256_sub_ps(speed, _mm256_add_ps(drag, _mm256_set1_ps(0.1f)));
+
+        __m256 yawDrag = _mm256_sub_ps(_mm256_set1_ps(1.0f),
+                                       sine_avx2(_mm256_add_epi32(yawVel, _mm256_set1_epi32(0x4000))));
+        yawDrag = _mm256_mul_ps(yawDrag, _mm256_set1_ps(0.5f));
+        no_contract(yawDrag);
+        speed = _mm256_sub_ps(speed, yawDrag);
+
+        __m256 negative = _mm256_cmp_ps(speed, _mm256_setzero_ps(), _CMP_LT_OQ);
+        speed = _mm256_blendv_ps(speed, _mm256_setzero_ps(), negative);
+
+        __m256 fast = _mm256_cmp_ps(speed, _mm256_set1_ps(16.0f), _CMP_GT_OQ);
+        __m256 slow = _mm256_cmp_ps(speed, _mm256_set1_ps(4.0f), _CMP_GT_OQ);
+        __m256 jerk = _mm256_mul_ps(_mm256_sub_ps(speed, _mm256_set1_ps(32.0f)),
+                                    _mm256_blendv_ps(_mm256_set1_ps(10.0f), _mm256_set1_ps(6.0f), fast));
+        no_contract(jerk);
+        __m256i jerked = wrap_s16_avx2(
+            _mm256_cvttps_epi32(_mm256_add_ps(_mm256_cvtepi32_ps(pitch), jerk)));
+        __m256i stalled = wrap_s16_avx2(_mm256_sub_epi32(pitch, _mm256_set1_epi32(0x400)));
+        pitch = _mm256_blendv_epi8(stalled, jerked, _mm256_castps_si256(slow));
+
+        pitch = wrap_s16_avx2(_mm256_add_epi32(pitch, pitchVel));
+        pitch = _mm256_max_epi32(_mm256_min_epi32(pitch, maxPitch), minPitch);
+
+        __m256 velY = _mm256_mul_ps(speed, sine_avx2(pitch));
+        no_contract(velY);
+        _mm256_store_ps(&b->posY[i], _mm256_add_ps(_mm256_load_ps(&b->posY[i]), velY));
+
+        if (downTilt)
+            pitch = _mm256_max_epi32(_mm256_sub_epi32(pitch, _mm256_set1_epi32(0x200)), minPitch);
+
+        _mm256_store_ps(&b->forwardVel[i], speed);
+        store_s16_avx2(&b->faceAngle[0][i], pitch);
+    }
+}
+
+
+AVX512_FN static inline __m512i wrap_s16_avx512(__m512i x)
+{
+    return _mm512_srai_epi32(_mm512_slli_epi32(x, 16), 16);
+}
+
+AVX512_FN static inline __m512i load_s16_avx512(const s16 *p)
+{
+    return _mm512_cvtepi16_epi32(_mm256_load_si256((const __m256i *) p));
+}
+
+AVX512_FN static inline void store_s16_avx512(s16 *p, __m512i x)
+{
+    _mm256_store_si256((__m256i *) p, _mm512_cvtepi32_epi16(x));
+}
+
+AVX512_FN static inline __m512i approach_avx512(__m512i cur, __m512i target, s32 inc, s32 dec)
+{
+    __m512i up = _mm512_min_epi32(_mm512_add_epi32(cur, _mm512_set1_epi32(inc)), target);
+    __m512i down = _mm512_max_epi32(_mm512_sub_epi32(cur, _mm512_set1_epi32(dec)), target);
+    return _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(cur, target), down, up);
+}
+
+AVX512_FN static inline __m512i angle_vel_avx512(__m512i vel, __m512 stick, __m512 speed,
+                                                 f32 divisor, s32 small)
+{
+    __m512 scaled = _mm512_mul_ps(stick, _mm512_div_ps(speed, _mm512_set1_ps(divisor)));
+    __m512i target = wrap_s16_avx512(_mm512_sub_epi32(_mm512_setzero_si512(),
+                                                      wrap_s16_avx512(_mm512_cvttps_epi32(scaled))));
+    __m512i zero = _mm512_setzero_si512();
+
+    __m512i posFlip = _mm512_min_epi32(_mm512_add_epi32(vel, _mm512_set1_epi32(0x40)),
+                                       _mm512_set1_epi32(small));
+    __m512i posApproach = approach_avx512(vel, target, small, 2 * small);
+    __m512i pos = _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(vel, zero), posApproach, posFlip);
+
+    __m512i negFlip = _mm512_max_epi32(_mm512_sub_epi32(vel, _mm512_set1_epi32(0x40)),
+                                       _mm512_set1_epi32(-small));
+    __m512i negApproach = approach_avx512(vel, target, 2 * small, small);
+    __m512i neg = _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(vel, zero), negApproach, negFlip);
+
+    __m512i none = approach_avx512(vel, zero, 0x40, 0x40);
+
+    __m512i result = _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(target, zero), none, neg);
+    return _mm512_mask_blend_epi32(_mm512_cmpgt_epi32_mask(target, zero), result, pos);
+}
+
+AVX512_FN static inline __m512 sine_avx512(__m512i angle)
+{
+    __m512i index = _mm512_srli_epi32(_mm512_and_si512(angle, _mm512_set1_epi32(0xFFFF)), 4);
+    return _mm512_i32gather_ps(index, gSineTable, 4);
+}
+
+AVX512_FN void flight_batch_step_avx512(struct FlightBatch *b, s32 downTilt)
+{
+    const __m512i maxPitch = _mm512_set1_epi32(0x2AAA);
+    const __m512i minPitch = _mm512_set1_epi32(-0x2AAA);
+
+    for (s32 i = 0; i < b->count; i += 16) {
+        __m512 speed = _mm512_load_ps(&b->forwardVel[i]);
+        __m512i pitch = load_s16_avx512(&b->faceAngle[0][i]);
+        __m512i yaw = load_s16_avx512(&b->faceAngle[1][i]);
+
+        __m512i pitchVel = angle_vel_avx512(load_s16_avx512(&b->angleVel[0][i]),
+                                            _mm512_load_ps(&b->stickY[i]), speed, 5.0f, 0x20);
+        __m512i yawVel = angle_vel_avx512(load_s16_avx512(&b->angleVel[1][i]),
+                                          _mm512_load_ps(&b->stickX[i]), speed, 4.0f, 0x10);
+
+        store_s16_avx512(&b->angleVel[0][i], pitchVel);
+        store_s16_avx512(&b->angleVel[1][i], yawVel);
+        store_s16_avx512(&b->faceAngle[1][i], _mm512_add_epi32(yaw, yawVel));
+        store_s16_avx512(&b->faceAngle[2][i], _mm512_mullo_epi32(yawVel, _mm512_set1_epi32(-20)));
+
+        __m512 drag = _mm512_mul_ps(_mm512_cvtepi32_ps(pitch), _mm512_set1_ps(1.0f / 0x2000));
+        no_contract(drag);
+        speed = _mm512_sub_ps(speed, _mm512_add_ps(drag, _mm512_set1_ps(0.1f)));
+
+        __m512 yawDrag = _mm512_sub_ps(_mm512_set1_ps(1.0f),
+                                       sine_avx512(_mm512_add_epi32(yawVel, _mm512_set1_epi32(0x4000))));
+        yawDrag = _mm512_mul_ps(yawDrag, _mm512_set1_ps(0.5f));
+        no_contract(yawDrag);
+        speed = _mm512_sub_ps(speed, yawDrag);
+
+        __mmask16 negative = _mm512_cmp_ps_mask(speed, _mm512_setzero_ps(), _CMP_LT_OQ);
+        speed = _mm512_mask_blend_ps(negative, speed, _mm512_setzero_ps());
+
+        __mmask16 fast = _mm512_cmp_ps_mask(speed, _mm512_set1_ps(16.0f), _CMP_GT_OQ);
+        __mmask16 slow = _mm512_cmp_ps_mask(speed, _mm512_set1_ps(4.0f), _CMP_GT_OQ);
+        __m512 jerk = _mm512_mul_ps(_mm512_sub_ps(speed, _mm512_set1_ps(32.0f)),
+                                    _mm512_mask_blend_ps(fast, _mm512_set1_ps(10.0f), _mm512_set1_ps(6.0f)));
+        no_contract(jerk);
+        __m512i jerked = wrap_s16_avx512(
+            _mm512_cvttps_epi32(_mm512_add_ps(_mm512_cvtepi32_ps(pitch), jerk)));
+        __m512i stalled = wrap_s16_avx512(_mm512_sub_epi32(pitch, _mm512_set1_epi32(0x400)));
+        pitch = _mm512_mask_blend_epi32(slow, stalled, jerked);
+
+        pitch = wrap_s16_avx512(_mm512_add_epi32(pitch, pitchVel));
+        pitch = _mm512_max_epi32(_mm512_min_epi32(pitch, maxPitch), minPitch);
+
+        __m512 velY = _mm512_mul_ps(speed, sine_avx512(pitch));
+        no_contract(velY);
+        _mm512_store_ps(&b->posY[i], _mm512_add_ps(_mm512_load_ps(&b->posY[i]), velY));
+
+        if (downTilt)
+            pitch = _mm512_max_epi32(_mm512_sub_epi32(pitch, _mm512_set1_epi32(0x200)), minPitch);
+
+        _mm512_store_ps(&b->forwardVel[i], speed);
+        store_s16_avx512(&b->faceAngle[0][i], pitch);
+    }
+}
+
+#endif
@@ -0,0 +1,933 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_beam.h"
+#include "flight_batch.h"
+#include "flight_control.h"
+#include "flight_prune.h"
+#include "flight_run.h"
+#include "pareto.h"
+#include "transposition.h"
+#include "work_pool.h"
+
+
+// Parents expanded by one pool task. Each task's children start at a multiple
+// of FLIGHT_BATCH_ALIGN, so it can step its own view of the batch.
+#define BEAM_PARENTS_PER_TASK 16
+
+// Children that can't stay this far above RUN_DEATH_Y rank below all others.
+// The margin shrinks by BEAM_SAFE_MARGIN_PER_FRAME over the last frames, since
+// a state near the end of the budget doesn't have to climb out again.
+#define BEAM_SAFE_MARGIN 1000.0f
+#define BEAM_SAFE_MARGIN_PER_FRAME 20.0f
+
+const char *gBeamScoreNames[BEAM_SCORE_COUNT] = { "energy", "maxy", "target" };
+
+struct BeamCandidate
+{
+    s32 safe;
+    f64 primary;
+    f64 secondary;
+    s32 child;
+};
+
+// States kept after a frame, with what is known about the path to each
+struct BeamNodes
+{
+    struct FlightBatch states;
+    f32 *maxY;
+    f32 *minY;
+    s32 *framesToTarget;
+    // Last input in the history arena
+    s32 *history;
+};
+
+struct BeamSearch
+{
+    const struct BeamOptions *options;
+    s32 frame;
+
+    // Upper bound on the inputs per parent
+    s32 numSticks;
+    f32 stickY[256];
+
+    struct BeamNodes beam;
+    struct BeamNodes next;
+
+    // Inputs with distinct outcomes, numSticks slots per parent
+    struct PitchVelInput *inputs;
+    s32 *numInputs;
+    // First child of each task, padded to FLIGHT_BATCH_ALIGN
+    s32 *taskChildren;
+
+    struct FlightBatch children;
+    s32 *childParent;
+    s8 *childRawStickY;
+    struct BeamCandidate *candidates;
+    struct FlightKey *childKeys;
+    u64 *childHashes;
+
+    // Inputs of every path still in the beam, stored as a tree of parent links
+    s32 *historyParent;
+    s8 *historyStick;
+    s32 historyCount;
+    s32 historyCapacity;
+    s32 nextCompaction;
+
+    struct TranspositionTable transpositions;
+    // Children whose states came up so far this frame, as an open addressing set
+    // of child indices with -1 for empty slots
+    s32 *frameStates;
+    u64 frameStatesCapacity;
+
+    struct ParetoFrontier frontier;
+    u8 *onFrontier;
+
+    // Best max y in the beam, which a state has to be able to beat to be kept
+    f32 incumbent;
+    // One per thread
+    struct PruneStats *pruneStats;
+    // Children this frame that fell below RUN_DEATH_Y or were cut by the death
+    // bound, one count per thread
+    s64 *deaths;
+
+    // The climb/dive controller's path, state after each frame until it dies.
+    // It's never pruned or dropped, so the search does at least as well as run().
+    struct FlightKey *guideKeys;
+    s32 guideFrames;
+    // Lane of the beam on the controller's path, or -1 once it has ended
+    s32 guide;
+    // Child continuing it this frame, or -1
+    s32 guideChild;
+};
+
+static void *beam_alloc(size_t size) {
+    void *p = malloc(max(size, 1));
+    if (p == NULL) {
+        printf("Failed to allocate %zu bytes for the beam search\n", size);
+        exit(1);
+    }
+    return p;
+}
+
+static void beam_nodes_init(struct BeamNodes *n, s32 width) {
+    flight_batch_init(&n->states, width);
+    n->maxY = beam_alloc(width * sizeof(f32));
+    n->minY = beam_alloc(width * sizeof(f32));
+    n->framesToTarget = beam_alloc(width * sizeof(s32));
+    n->history = beam_alloc(width * sizeof(s32));
+}
+
+static void beam_nodes_free(struct BeamNodes *n) {
+    flight_batch_free(&n->states);
+    free(n->maxY);
+    free(n->minY);
+    free(n->framesToTarget);
+    free(n->history);
+}
+
+static void copy_lane(struct FlightBatch *dst, s32 i, const struct FlightBatch *src, s32 j) {
+    dst->posY[i] = src->posY[j];
+    dst->forwardVel[i] = src->forwardVel[j];
+    dst->faceAngle[0][i] = src->faceAngle[0][j];
+    dst->faceAngle[1][i] = src->faceAngle[1][j];
+    dst->faceAngle[2][i] = src->faceAngle[2][j];
+    dst->angleVel[0][i] = src->angleVel[0][j];
+    dst->angleVel[1][i] = src->angleVel[1][j];
+}
+
+static void lane_key(const struct FlightBatch *b, s32 i, struct FlightKey *key) {
+    memcpy(&key->posY, &b->posY[i], sizeof(u32));
+    memcpy(&key->forwardVel, &b->forwardVel[i], sizeof(u32));
+    key->pitch = b->faceAngle[0][i];
+    key->pitchVel = b->angleVel[0][i];
+    key->yaw = b->faceAngle[1][i];
+    key->yawVel = b->angleVel[1][i];
+}
+
+static s32 child_frames_to_target(struct BeamSearch *s, s32 parent, f32 maxY) {
+    if (s->beam.framesToTarget[parent] >= 0) {
+        return s->beam.framesToTarget[parent];
+    }
+    return maxY >= RUN_TARGET_Y ? s->frame + 1 : -1;
+}
+
+// The bound that rules out a child, or -1 if none does
+static s32 prune_child(struct BeamSearch *s, s32 child, s32 thread, f32 maxY, s32 framesToTarget) {
+    const struct FlightBatch *b = &s->children;
+    f32 incumbent = -INFINITY;
+
+    if (s->options->score == BEAM_SCORE_MAX_Y) {
+        incumbent = s->incumbent;
+    } else if (s->options->score == BEAM_SCORE_TARGET && framesToTarget < 0) {
+        incumbent = RUN_TARGET_Y;
+    }
+
+    return prune_node(&s->pruneStats[thread], b->posY[child], b->forwardVel[child], b->faceAngle[0][child],
+        b->angleVel[0][child], maxY, incumbent, s->options->frames - (s->frame + 1));
+}
+
+// Whether a child is the next state on the controller's path
+static s32 is_guide_child(struct BeamSearch *s, s32 child) {
+    struct FlightKey key;
+
+    if (s->childParent[child] != s->guide || s->frame >= s->guideFrames) {
+        return FALSE;
+    }
+    lane_key(&s->children, child, &key);
+    return memcmp(&key, &s->guideKeys[s->frame], sizeof(key)) == 0;
+}
+
+/**
+ * Estimated max y if Mario climbed like the controller from here on, for at
+ * most framesLeft frames: at the climb pitch, losing speed at a constant rate
+ * until it drops to the speed where the controller dives again.
+ */
+static f32 climb_reach(f32 posY, f32 forwardVel, s32 framesLeft) {
+    const struct RunParams *params = &gRunParamsDefault;
+    f64 drag = 2.0 * (params->climbPitch - 0x200) / 0x4000 + 0.1;
+    f64 frames = min(max(forwardVel - params->climbMinSpeed, 0.0) / drag, framesLeft);
+
+    return posY + sins(params->climbPitch) * (forwardVel * frames - drag / 2 * frames * frames);
+}
+
+static void score_child(struct BeamSearch *s, s32 child, s32 thread, struct BeamCandidate *c) {
+    const struct FlightBatch *b = &s->children;
+    s32 parent = s->childParent[child];
+    f32 maxY = max(s->beam.maxY[parent], b->posY[child]);
+
+    c->child = child;
+    s32 bound = -1;
+    if (is_guide_child(s, child)) {
+        s->guideChild = child;
+    } else if (b->posY[child] < RUN_DEATH_Y) {
+        bound = PRUNE_DEATH;
+    } else if (s->options->prune) {
+        bound = prune_child(s, child, thread, maxY, child_frames_to_target(s, parent, maxY));
+    }
+    if (bound >= 0) {
+        s->deaths[thread] += bound == PRUNE_DEATH;
+        c->safe = FALSE;
+        c->primary = -INFINITY;
+        c->secondary = -INFINITY;
+        return;
+    }
+
+    // Ranking by speed alone would dive every state to the death plane, and by
+    // max y alone wouldn't say which states can still climb higher
+    s32 framesLeft = s->options->frames - (s->frame + 1);
+    f32 margin = min(BEAM_SAFE_MARGIN, BEAM_SAFE_MARGIN_PER_FRAME * framesLeft);
+    f32 reach = climb_reach(b->posY[child], b->forwardVel[child], framesLeft);
+    c->safe = min_y_bound(b->posY[child], b->forwardVel[child], b->faceAngle[0][child], b->angleVel[0][child])
+        >= RUN_DEATH_Y + margin;
+
+    switch (s->options->score) {
+    case BEAM_SCORE_MAX_Y:
+        c->primary = max(maxY, reach);
+        c->secondary = reach;
+        break;
+    case BEAM_SCORE_TARGET: {
+        s32 frames = child_frames_to_target(s, parent, maxY);
+        c->primary = frames >= 0 ? -frames : -1e9;
+        c->secondary = reach;
+        break;
+    }
+    default:
+        c->primary = flight_energy(b->posY[child], b->forwardVel[child]);
+        c->secondary = 0;
+        break;
+    }
+}
+
+// Finds the inputs worth trying for one group of parents
+static void beam_find_inputs(void *arg, s32 index, s32 thread) {
+    (void) thread;
+    struct BeamSearch *s = arg;
+    s32 firstParent = index * BEAM_PARENTS_PER_TASK;
+    s32 lastParent = min(firstParent + BEAM_PARENTS_PER_TASK, s->beam.states.count);
+    struct MarioState m;
+
+    for (s32 parent = firstParent; parent < lastParent; parent++) {
+        m.forwardVel = s->beam.states.forwardVel[parent];
+        m.angleVel[0] = s->beam.states.angleVel[0][parent];
+        s->numInputs[parent] = distinct_pitch_vel_inputs(&m, &s->inputs[parent * s->numSticks]);
+    }
+}
+
+// Expands, steps and scores one group of parents
+static void beam_expand(void *arg, s32 index, s32 thread) {
+    struct BeamSearch *s = arg;
+    s32 firstParent = index * BEAM_PARENTS_PER_TASK;
+    s32 lastParent = min(firstParent + BEAM_PARENTS_PER_TASK, s->beam.states.count);
+    s32 firstChild = s->taskChildren[index];
+    s32 lastChild = s->taskChildren[index + 1];
+
+    s32 child = firstChild;
+    for (s32 parent = firstParent; parent < lastParent; parent++) {
+        for (s32 i = 0; i < s->numInputs[parent]; i++) {
+            s8 rawStickY = s->inputs[parent * s->numSticks + i].rawStickY;
+            copy_lane(&s->children, child, &s->beam.states, parent);
+            s->children.stickX[child] = 0.0f;
+            s->children.stickY[child] = s->stickY[rawStickY + 128];
+            s->childParent[child] = parent;
+            s->childRawStickY[child] = rawStickY;
+            child += 1;
+        }
+    }
+    s32 lastReal = child;
+
+    // Padding up to the next task gets stepped too, so give it a valid state
+    for (; child < lastChild; child++) {
+        copy_lane(&s->children, child, &s->beam.states, firstParent);
+        s->children.stickX[child] = 0.0f;
+        s->children.stickY[child] = 0.0f;
+    }
+
+    struct FlightBatch view;
+    flight_batch_view(&view, &s->children, firstChild, lastChild - firstChild);
+    flight_batch_step(&view, TRUE);
+
+    for (child = firstChild; child < lastReal; child++) {
+        score_child(s, child, thread, &s->candidates[child]);
+    }
+    if (s->options->transpositionBytes > 0) {
+        for (child = firstChild; child < lastReal; child++) {
+            lane_key(&s->children, child, &s->childKeys[child]);
+            s->childHashes[child] = flight_key_hash(&s->childKeys[child]);
+        }
+    }
+    for (; child < lastChild; child++) {
+        s->candidates[child].primary = -INFINITY;
+    }
+}
+
+static s32 candidate_better(const struct BeamCandidate *a, const struct BeamCandidate *b) {
+    if (a->safe != b->safe) {
+        return a->safe;
+    }
+    if (a->primary != b->primary) {
+        return a->primary > b->primary;
+    }
+    if (a->secondary != b->secondary) {
+        return a->secondary > b->secondary;
+    }
+    return a->child < b->child;
+}
+
+static void swap_candidates(struct BeamCandidate *c, s32 i, s32 j) {
+    struct BeamCandidate t = c[i];
+    c[i] = c[j];
+    c[j] = t;
+}
+
+// Quickselect: moves the k best candidates to the front, in no particular order
+static void select_best(struct BeamCandidate *c, s32 count, s32 k) {
+    s32 lo = 0;
+    s32 hi = count - 1;
+
+    while (lo < hi) {
+        s32 mid = lo + (hi - lo) / 2;
+        if (candidate_better(&c[mid], &c[lo])) {
+            swap_candidates(c, lo, mid);
+        }
+        if (candidate_better(&c[hi], &c[lo])) {
+            swap_candidates(c, lo, hi);
+        }
+        if (candidate_better(&c[hi], &c[mid])) {
+            swap_candidates(c, mid, hi);
+        }
+
+        struct BeamCandidate pivot = c[mid];
+        s32 i = lo;
+        s32 j = hi;
+        while (i <= j) {
+            while (candidate_better(&c[i], &pivot)) {
+                i++;
+            }
+            while (candidate_better(&pivot, &c[j])) {
+                j--;
+            }
+            if (i <= j) {
+                swap_candidates(c, i, j);
+                i++;
+                j--;
+            }
+        }
+
+        if (k - 1 <= j) {
+            hi = j;
+        } else if (k - 1 >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+}
+
+static s32 push_history(struct BeamSearch *s, s32 parent, s8 rawStickY) {
+    if (s->historyCount == s->historyCapacity) {
+        s->historyCapacity = max(2 * s->historyCapacity, 1 << 16);
+        s->historyParent = realloc(s->historyParent, s->historyCapacity * sizeof(s32));
+        s->historyStick = realloc(s->historyStick, s->historyCapacity * sizeof(s8));
+        if (s->historyParent == NULL || s->historyStick == NULL) {
+            printf("Failed to allocate %d beam history entries\n", s->historyCapacity);
+            exit(1);
+        }
+    }
+
+    s->historyParent[s->historyCount] = parent;
+    s->historyStick[s->historyCount] = rawStickY;
+    return s->historyCount++;
+}
+
+// Drops inputs that no path in the beam leads through. Parents always come
+// before their children, so one forward pass renumbers everything in place.
+static void compact_history(struct BeamSearch *s) {
+    s32 *newIndex = beam_alloc(s->historyCount * sizeof(s32));
+    memset(newIndex, 0xFF, s->historyCount * sizeof(s32));
+
+    for (s32 i = 0; i < s->beam.states.count; i++) {
+        for (s32 h = s->beam.history[i]; h >= 0 && newIndex[h] < 0; h = s->historyParent[h]) {
+            newIndex[h] = 0;
+        }
+    }
+
+    s32 count = 0;
+    for (s32 h = 0; h < s->historyCount; h++) {
+        if (newIndex[h] < 0) {
+            continue;
+        }
+        s32 parent = s->historyParent[h];
+        s->historyParent[count] = parent >= 0 ? newIndex[parent] : -1;
+        s->historyStick[count] = s->historyStick[h];
+        newIndex[h] = count++;
+    }
+
+    for (s32 i = 0; i < s->beam.states.count; i++) {
+        s->beam.history[i] = s->beam.history[i] >= 0 ? newIndex[s->beam.history[i]] : -1;
+    }
+
+    s->historyCount = count;
+    s->nextCompaction = max(2 * count, count + 64 * s->options->width);
+    free(newIndex);
+}
+
+// Whether an earlier child this frame reached the same state. Records the child
+// if not.
+static s32 seen_this_frame(struct BeamSearch *s, s32 child, u64 mask) {
+    for (u64 i = s->childHashes[child] & mask; ; i = (i + 1) & mask) {
+        s32 other = s->frameStates[i];
+        if (other < 0) {
+            s->frameStates[i] = child;
+            return FALSE;
+        }
+        if (s->childHashes[other] == s->childHashes[child]
+                && memcmp(&s->childKeys[other], &s->childKeys[child], sizeof(struct FlightKey)) == 0) {
+            return TRUE;
+        }
+    }
+}
+
+static void mark_on_frontier(void *arg, s32 id) {
+    ((u8 *) arg)[id] = TRUE;
+}
+
+// Drops the candidates some other candidate dominates, keeping their order. The
+// best candidate and the controller's path are always kept.
+static s32 filter_dominated(struct BeamSearch *s, s32 count) {
+    const struct FlightBatch *b = &s->children;
+    s32 best = 0;
+
+    pareto_clear(&s->frontier);
+    for (s32 i = 0; i < count; i++) {
+        s32 child = s->candidates[i].child;
+        pareto_insert(&s->frontier, b->faceAngle[0][child], b->angleVel[0][child], b->posY[child],
+            b->forwardVel[child], i);
+        s->onFrontier[i] = FALSE;
+        if (candidate_better(&s->candidates[i], &s->candidates[best])) {
+            best = i;
+        }
+    }
+    pareto_for_each(&s->frontier, mark_on_frontier, s->onFrontier);
+    s->onFrontier[best] = TRUE;
+    for (s32 i = 0; i < count; i++) {
+        if (s->candidates[i].child == s->guideChild) {
+            s->onFrontier[i] = TRUE;
+        }
+    }
+
+    s32 kept = 0;
+    for (s32 i = 0; i < count; i++) {
+        if (s->onFrontier[i]) {
+            s->candidates[kept++] = s->candidates[i];
+        }
+    }
+    return kept;
+}
+
+// Makes sure the controller's path is among the first count candidates, in
+// place of the worst of them
+static void keep_guide(struct BeamSearch *s, s32 numAlive, s32 count) {
+    s32 worst = 0;
+    for (s32 i = 0; i < count; i++) {
+        if (s->candidates[i].child == s->guideChild) {
+            return;
+        }
+        if (candidate_better(&s->candidates[worst], &s->candidates[i])) {
+            worst = i;
+        }
+    }
+    for (s32 i = count; i < numAlive; i++) {
+        if (s->candidates[i].child == s->guideChild) {
+            swap_candidates(s->candidates, worst, i);
+            return;
+        }
+    }
+}
+
+// Moves the selected children into the next beam and swaps it in
+static void advance_beam(struct BeamSearch *s, s32 count) {
+    s->guide = -1;
+    for (s32 i = 0; i < count; i++) {
+        s32 child = s->candidates[i].child;
+        s32 parent = s->childParent[child];
+        f32 posY = s->children.posY[child];
+
+        if (child == s->guideChild) {
+            s->guide = i;
+        }
+        copy_lane(&s->next.states, i, &s->children, child);
+        s->next.maxY[i] = max(s->beam.maxY[parent], posY);
+        s->next.minY[i] = min(s->beam.minY[parent], posY);
+        s->next.framesToTarget[i] = child_frames_to_target(s, parent, s->next.maxY[i]);
+        s->next.history[i] = push_history(s, s->beam.history[parent], s->childRawStickY[child]);
+    }
+    s->next.states.count = count;
+
+    struct BeamNodes t = s->beam;
+    s->beam = s->next;
+    s->next = t;
+
+    if (s->historyCount >= s->nextCompaction) {
+        compact_history(s);
+    }
+}
+
+// Flies the climb/dive controller from the start for the frame budget, stopping
+// if it dies
+static void find_guide(struct BeamSearch *s, const struct MarioState *start) {
+    struct MarioState m = *start;
+    struct Controller controller;
+    struct RunPolicy policy;
+
+    m.controller = &controller;
+    s->guideKeys = beam_alloc(s->options->frames * sizeof(struct FlightKey));
+    s->guideFrames = 0;
+
+    run_policy_init(&policy, &m, &gRunParamsDefault);
+    while (s->guideFrames < s->options->frames) {
+        adjust_analog_stick(m.controller, 0, run_policy_stick(&policy, &m, NULL));
+        act_flying(&m, TRUE);
+        run_policy_update(&policy, &m);
+        if (m.pos[1] < RUN_DEATH_Y) {
+            break;
+        }
+
+        struct FlightKey *key = &s->guideKeys[s->guideFrames++];
+        memcpy(&key->posY, &m.pos[1], sizeof(u32));
+        memcpy(&key->forwardVel, &m.forwardVel, sizeof(u32));
+        key->pitch = m.faceAngle[0];
+        key->pitchVel = m.angleVel[0];
+        key->yaw = m.faceAngle[1];
+        key->yawVel = m.angleVel[1];
+    }
+}
+
+// Whether lane i's path has a better outcome than lane j's: reaching
+// RUN_TARGET_Y sooner, then a higher max y
+static s32 lane_outcome_better(const struct BeamNodes *n, s32 i, s32 j) {
+    s32 framesI = n->framesToTarget[i];
+    s32 framesJ = n->framesToTarget[j];
+
+    if (framesI != framesJ) {
+        if (framesI < 0 || framesJ < 0) {
+            return framesJ < 0;
+        }
+        return framesI < framesJ;
+    }
+    return n->maxY[i] > n->maxY[j];
+}
+
+// Identifies the search a checkpoint belongs to
+static u64 beam_config(const struct MarioState *m, const struct BeamOptions *options) {
+    u64 transpositionBytes = options->transpositionBytes;
+    u64 hash = CHECKPOINT_HASH_INIT;
+
+    hash = checkpoint_hash(hash, &m->pos[1], sizeof(f32));
+    hash = checkpoint_hash(hash, &m->forwardVel, sizeof(f32));
+    hash = checkpoint_hash(hash, m->faceAngle, 3 * sizeof(s16));
+    hash = checkpoint_hash(hash, m->angleVel, 2 * sizeof(s16));
+    hash = checkpoint_hash(hash, &options->width, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->frames, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->score, sizeof(s32));
+    hash = checkpoint_hash(hash, &transpositionBytes, sizeof(u64));
+    hash = checkpoint_hash(hash, &options->prune, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->pareto, sizeof(s32));
+    return hash;
+}
+
+struct BeamProgress
+{
+    s32 frame;
+    s32 best;
+    s32 count;
+    s32 historyCount;
+    s32 nextCompaction;
+    s32 guide;
+    s64 totalParents;
+    s64 totalChildren;
+    struct PruneStats pruned;
+};
+
+static void save_beam(struct BeamSearch *s, u64 config, s32 best, s64 totalParents, s64 totalChildren) {
+    const struct FlightBatch *b = &s->beam.states;
+    struct BeamProgress progress = { s->frame, best, b->count, s->historyCount, s->nextCompaction, s->guide,
+        totalParents, totalChildren, { 0 } };
+    for (s32 i = 0; i < s->options->numThreads; i++) {
+        prune_stats_add(&progress.pruned, &s->pruneStats[i]);
+    }
+
+    struct CheckpointWriter w;
+    checkpoint_begin(&w, s->options->checkpoint.path, CHECKPOINT_BEAM, config);
+    checkpoint_write(&w, &progress, sizeof(progress));
+    checkpoint_write(&w, b->posY, b->count * sizeof(f32));
+    checkpoint_write(&w, b->forwardVel, b->count * sizeof(f32));
+    for (s32 i = 0; i < 3; i++) {
+        checkpoint_write(&w, b->faceAngle[i], b->count * sizeof(s16));
+    }
+    for (s32 i = 0; i < 2; i++) {
+        checkpoint_write(&w, b->angleVel[i], b->count * sizeof(s16));
+    }
+    checkpoint_write(&w, s->beam.maxY, b->count * sizeof(f32));
+    checkpoint_write(&w, s->beam.minY, b->count * sizeof(f32));
+    checkpoint_write(&w, s->beam.framesToTarget, b->count * sizeof(s32));
+    checkpoint_write(&w, s->beam.history, b->count * sizeof(s32));
+    checkpoint_write(&w, s->historyParent, s->historyCount * sizeof(s32));
+    checkpoint_write(&w, s->historyStick, s->historyCount * sizeof(s8));
+    if (s->options->transpositionBytes > 0) {
+        transposition_save(&s->transpositions, &w);
+    }
+    checkpoint_end(&w);
+}
+
+// Returns FALSE if there is no checkpoint to resume from
+static s32 load_beam(struct BeamSearch *s, u64 config, s32 *best, s64 *totalParents, s64 *totalChildren) {
+    struct FlightBatch *b = &s->beam.states;
+    struct CheckpointReader r;
+    struct BeamProgress progress;
+
+    if (!checkpoint_open(&r, s->options->checkpoint.path, CHECKPOINT_BEAM, config)) {
+        return FALSE;
+    }
+    checkpoint_read(&r, &progress, sizeof(progress));
+    if (progress.count < 1 || progress.count > s->options->width || progress.best < 0
+            || progress.best >= progress.count || progress.historyCount < 0 || progress.guide < -1
+            || progress.guide >= progress.count) {
+        printf("%s is corrupt\n", r.path);
+        exit(1);
+    }
+
+    s->frame = progress.frame;
+    *best = progress.best;
+    b->count = progress.count;
+    s->nextCompaction = progress.nextCompaction;
+    s->guide = progress.guide;
+    *totalParents = progress.totalParents;
+    *totalChildren = progress.totalChildren;
+    s->pruneStats[0] = progress.pruned;
+
+    checkpoint_read(&r, b->posY, b->count * sizeof(f32));
+    checkpoint_read(&r, b->forwardVel, b->count * sizeof(f32));
+    for (s32 i = 0; i < 3; i++) {
+        checkpoint_read(&r, b->faceAngle[i], b->count * sizeof(s16));
+    }
+    for (s32 i = 0; i < 2; i++) {
+        checkpoint_read(&r, b->angleVel[i], b->count * sizeof(s16));
+    }
+    checkpoint_read(&r, s->beam.maxY, b->count * sizeof(f32));
+    checkpoint_read(&r, s->beam.minY, b->count * sizeof(f32));
+    checkpoint_read(&r, s->beam.framesToTarget, b->count * sizeof(s32));
+    checkpoint_read(&r, s->beam.history, b->count * sizeof(s32));
+
+    s->historyCount = progress.historyCount;
+    s->historyCapacity = max(s->historyCount, 1 << 16);
+    s->historyParent = beam_alloc(s->historyCapacity * sizeof(s32));
+    s->historyStick = beam_alloc(s->historyCapacity * sizeof(s8));
+    checkpoint_read(&r, s->historyParent, s->historyCount * sizeof(s32));
+    checkpoint_read(&r, s->historyStick, s->historyCount * sizeof(s8));
+
+    if (s->options->transpositionBytes > 0) {
+        transposition_load(&s->transpositions, &r);
+    }
+    checkpoint_close(&r);
+    return TRUE;
+}
+
+void beam_search(const struct MarioState *m, const struct BeamOptions *options,
+                 struct TasInputs *tasInputs, struct RunResult *result) {
+    struct BeamSearch s;
+    memset(&s, 0, sizeof(s));
+    s.options = options;
+    s.nextCompaction = 64 * options->width;
+
+    const f32 *stickY;
+    const s16 *rawStickY;
+    s.numSticks = stick_y_table(&stickY, &rawStickY);
+    for (s32 raw = -128; raw < 128; raw++) {
+        s.stickY[raw + 128] = raw_stick_to_stick_y(0, raw);
+    }
+
+    s32 maxTasks = (options->width + BEAM_PARENTS_PER_TASK - 1) / BEAM_PARENTS_PER_TASK;
+    s32 maxChildren = options->width * s.numSticks + maxTasks * FLIGHT_BATCH_ALIGN;
+
+    beam_nodes_init(&s.beam, options->width);
+    beam_nodes_init(&s.next, options->width);
+    s.inputs = beam_alloc(options->width * s.numSticks * sizeof(struct PitchVelInput));
+    s.numInputs = beam_alloc(options->width * sizeof(s32));
+    s.taskChildren = beam_alloc((maxTasks + 1) * sizeof(s32));
+    flight_batch_init(&s.children, maxChildren);
+    s.childParent = beam_alloc(maxChildren * sizeof(s32));
+    s.childRawStickY = beam_alloc(maxChildren * sizeof(s8));
+    s.candidates = beam_alloc(maxChildren * sizeof(struct BeamCandidate));
+
+    s.beam.states.count = 1;
+    s.beam.states.posY[0] = m->pos[1];
+    s.beam.states.forwardVel[0] = m->forwardVel;
+    for (s32 i = 0; i < 3; i++) {
+        s.beam.states.faceAngle[i][0] = m->faceAngle[i];
+    }
+    for (s32 i = 0; i < 2; i++) {
+        s.beam.states.angleVel[i][0] = m->angleVel[i];
+    }
+    s.beam.maxY[0] = m->pos[1];
+    s.beam.minY[0] = m->pos[1];
+    s.beam.framesToTarget[0] = m->pos[1] >= RUN_TARGET_Y ? 0 : -1;
+    s.beam.history[0] = -1;
+    s.frame = 0;
+    s.guide = 0;
+
+    s.pruneStats = beam_alloc(options->numThreads * sizeof(struct PruneStats));
+    memset(s.pruneStats, 0, options->numThreads * sizeof(struct PruneStats));
+    s.deaths = beam_alloc(options->numThreads * sizeof(s64));
+
+    if (options->transpositionBytes > 0) {
+        transposition_init(&s.transpositions, options->transpositionBytes);
+        s.childKeys = beam_alloc(maxChildren * sizeof(struct FlightKey));
+        s.childHashes = beam_alloc(maxChildren * sizeof(u64));
+        s.frameStatesCapacity = 1;
+        while (s.frameStatesCapacity < 2 * (u64) maxChildren) {
+            s.frameStatesCapacity *= 2;
+        }
+        s.frameStates = beam_alloc(s.frameStatesCapacity * sizeof(s32));
+    }
+
+    if (options->pareto) {
+        pareto_init(&s.frontier);
+        s.onFrontier = beam_alloc(maxChildren);
+    }
+
+    find_guide(&s, m);
+
+    s32 best = 0;
+    s32 died = FALSE;
+    s64 totalParents = 0;
+    s64 totalChildren = 0;
+
+    u64 config = beam_config(m, options);
+    if (options->checkpoint.path != NULL && load_beam(&s, config, &best, &totalParents, &totalChildren)) {
+        if (options->verbose) {
+            printf("Resuming from %s at frame %d\n", options->checkpoint.path, s.frame);
+        }
+    }
+    f64 lastSave = checkpoint_clock();
+
+    for (; s.frame < options->frames; s.frame++) {
+        if (checkpoint_due(&options->checkpoint, &lastSave)) {
+            save_beam(&s, config, best, totalParents, totalChildren);
+        }
+        if (options->score == BEAM_SCORE_TARGET && s.beam.framesToTarget[best] >= 0) {
+            break;
+        }
+
+        s.incumbent = s.beam.maxY[0];
+        for (s32 i = 1; i < s.beam.states.count; i++) {
+            s.incumbent = max(s.incumbent, s.beam.maxY[i]);
+        }
+
+        s32 numTasks = (s.beam.states.count + BEAM_PARENTS_PER_TASK - 1) / BEAM_PARENTS_PER_TASK;
+        work_pool_run(numTasks, options->numThreads, beam_find_inputs, &s);
+
+        memset(s.deaths, 0, options->numThreads * sizeof(s64));
+        s.guideChild = -1;
+
+        s32 numChildren = 0;
+        s32 numRealChildren = 0;
+        for (s32 t = 0; t < numTasks; t++) {
+            s.taskChildren[t] = numChildren;
+            s32 lastParent = min((t + 1) * BEAM_PARENTS_PER_TASK, s.beam.states.count);
+            for (s32 parent = t * BEAM_PARENTS_PER_TASK; parent < lastParent; parent++) {
+                numChildren += s.numInputs[parent];
+                numRealChildren += s.numInputs[parent];
+            }
+            numChildren = (numChildren + FLIGHT_BATCH_ALIGN - 1) / FLIGHT_BATCH_ALIGN * FLIGHT_BATCH_ALIGN;
+        }
+        s.taskChildren[numTasks] = numChildren;
+        s.children.count = numChildren;
+        totalParents += s.beam.states.count;
+
+        work_pool_run(numTasks, options->numThreads, beam_expand, &s);
+        if (s.guide >= 0 && s.frame < s.guideFrames && s.guideChild < 0) {
+            printf("Beam search lost the controller's path at frame %d\n", s.frame);
+            exit(1);
+        }
+
+        // Drops states a kept path reached on an earlier frame, and repeats within
+        // this frame. In child order, so the first path to a state keeps it
+        // whatever the thread count.
+        u64 frameMask = 0;
+        if (options->transpositionBytes > 0) {
+            u64 capacity = 1;
+            while (capacity < 2 * (u64) numChildren) {
+                capacity *= 2;
+            }
+            frameMask = capacity - 1;
+            memset(s.frameStates, 0xFF, (frameMask + 1) * sizeof(s32));
+        }
+        s32 numAlive = 0;
+        for (s32 i = 0; i < numChildren; i++) {
+            if (s.candidates[i].primary == -INFINITY) {
+                continue;
+            }
+            if (options->transpositionBytes > 0) {
+                if (i + 16 < numChildren) {
+                    transposition_prefetch(&s.transpositions, s.childHashes[i + 16]);
+                }
+                s32 seen = transposition_contains_hashed(&s.transpositions, &s.childKeys[i], s.childHashes[i], s.frame);
+                if (!seen && seen_this_frame(&s, i, frameMask)) {
+                    // Counted as a hit too, so the table's hit rate is the share of states dropped
+                    s.transpositions.hits += 1;
+                    seen = TRUE;
+                }
+                if (seen && i != s.guideChild) {
+                    continue;
+                }
+            }
+            s.candidates[numAlive++] = s.candidates[i];
+        }
+        if (options->pareto && numAlive > 0) {
+            numAlive = filter_dominated(&s, numAlive);
+        }
+        totalChildren += numAlive;
+        if (numAlive == 0) {
+            // Nothing left to search. Unless every child died, some were only
+            // duplicates or couldn't get high enough in time, and the best state
+            // so far is still the answer.
+            s64 deaths = 0;
+            for (s32 i = 0; i < options->numThreads; i++) {
+                deaths += s.deaths[i];
+            }
+            died = deaths == numRealChildren;
+            break;
+        }
+
+        s32 count = min(numAlive, options->width);
+        select_best(s.candidates, numAlive, count);
+        keep_guide(&s, numAlive, count);
+        if (options->transpositionBytes > 0) {
+            for (s32 i = 0; i < count; i++) {
+                s32 child = s.candidates[i].child;
+                transposition_insert_hashed(&s.transpositions, &s.childKeys[child], s.childHashes[child], s.frame + 1);
+            }
+        }
+        best = 0;
+        for (s32 i = 1; i < count; i++) {
+            if (candidate_better(&s.candidates[i], &s.candidates[best])) {
+                best = i;
+            }
+        }
+        advance_beam(&s, count);
+
+        if (options->verbose && (s.frame + 1) % 1000 == 0) {
+            printf("Frame %d: y = %f, v = %f, maxy = %f, history = %d, children per state = %.1f\n",
+                s.frame + 1, s.beam.states.posY[best], s.beam.states.forwardVel[best], s.beam.maxY[best],
+                s.historyCount, (f64) totalChildren / max(totalParents, 1));
+        }
+    }
+
+    if (options->verbose && options->transpositionBytes > 0) {
+        transposition_print_stats(&s.transpositions, stdout);
+    }
+    if (options->verbose && options->prune) {
+        struct PruneStats pruned = { 0 };
+        for (s32 i = 0; i < options->numThreads; i++) {
+            prune_stats_add(&pruned, &s.pruneStats[i]);
+        }
+        prune_print_stats(&pruned, stdout);
+    }
+
+    for (s32 i = 0; i < s.beam.states.count; i++) {
+        if (lane_outcome_better(&s.beam, i, best)) {
+            best = i;
+        }
+    }
+
+    result->maxY = s.beam.maxY[best];
+    result->minY = s.beam.minY[best];
+    result->framesToTarget = s.beam.framesToTarget[best];
+    result->died = died;
+    result->frames = s.frame;
+
+    if (tasInputs != NULL) {
+        s32 length = 0;
+        for (s32 h = s.beam.history[best]; h >= 0; h = s.historyParent[h]) {
+            length += 1;
+        }
+
+        s8 *inputs = beam_alloc(length);
+        s32 i = length;
+        for (s32 h = s.beam.history[best]; h >= 0; h = s.historyParent[h]) {
+            inputs[--i] = s.historyStick[h];
+        }
+        for (i = 0; i < length; i++) {
+            tas_inputs_push(tasInputs, 0, 0, inputs[i]);
+        }
+        free(inputs);
+    }
+
+    beam_nodes_free(&s.beam);
+    beam_nodes_free(&s.next);
+    free(s.inputs);
+    free(s.numInputs);
+    free(s.taskChildren);
+    flight_batch_free(&s.children);
+    free(s.childParent);
+    free(s.childRawStickY);
+    free(s.candidates);
+    free(s.historyParent);
+    free(s.historyStick);
+    free(s.pruneStats);
+    free(s.deaths);
+    free(s.guideKeys);
+    if (options->pareto) {
+        pareto_free(&s.frontier);
+        free(s.onFrontier);
+    }
+    if (options->transpositionBytes > 0) {
+        transposition_free(&s.transpositions);
+        free(s.childKeys);
+        free(s.childHashes);
+        free(s.frameStates);
+    }
+}
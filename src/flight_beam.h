@@ -0,0 +1,67 @@
+#ifndef FLIGHT_BEAM_H_
+#define FLIGHT_BEAM_H_
+
+#include <stddef.h>
+
+#include "checkpoint.h"
+#include "flight_physics.h"
+#include "flight_run.h"
+#include "tas_inputs.h"
+
+
+// Every score ranks states that can stay well above RUN_DEATH_Y first
+enum BeamScore
+{
+    // energy() of the state
+    BEAM_SCORE_ENERGY,
+    // Highest y reached so far or estimated for a climb in the frames left,
+    // then the estimate alone
+    BEAM_SCORE_MAX_Y,
+    // Fewest frames to RUN_TARGET_Y, then the estimated climb until the target
+    // is reached
+    BEAM_SCORE_TARGET,
+    BEAM_SCORE_COUNT,
+};
+
+struct BeamOptions
+{
+    // Number of states kept each frame
+    s32 width;
+    s32 frames;
+    s32 score;
+    s32 numThreads;
+    s32 verbose;
+    // Memory for a transposition table that drops states already reached by
+    // another path, or 0 to keep duplicates
+    size_t transpositionBytes;
+    // Cut states that can't avoid the death plane, or (with maxy and target) can't
+    // get high enough in the frames left, using the bounds in flight_prune.h
+    s32 prune;
+    // Each frame keep only the states no other state with the same pitch and pitch
+    // vel beats in both y and speed (see pareto.h). Not admissible, so it can
+    // lose the best path, but the best state by score is always kept.
+    s32 pareto;
+    // Saves the beam, the inputs leading to it and the transposition table
+    // between frames, and resumes from them
+    struct CheckpointOptions checkpoint;
+};
+
+extern const char *gBeamScoreNames[BEAM_SCORE_COUNT];
+
+/**
+ * Searches stick inputs from the given state, expanding one input per distinct
+ * next pitch vel each frame and keeping the best width states by the chosen
+ * score. States that fall below RUN_DEATH_Y are dropped. The climb/dive
+ * controller's path with gRunParamsDefault is always kept until it dies, so the
+ * result is never worse than run_until's over the same frames. The search stops
+ * after options->frames frames, when every state is dropped or pruned, or as
+ * soon as a state reaches the target when scoring by BEAM_SCORE_TARGET.
+ *
+ * The inputs of the state with the best outcome, reaching RUN_TARGET_Y soonest
+ * and then the highest max y, are appended to tasInputs unless it is NULL, and
+ * its outcome is stored in result. result->died is set if every state died.
+ */
+void beam_search(const struct MarioState *m, const struct BeamOptions *options,
+                 struct TasInputs *tasInputs, struct RunResult *result);
+
+#endif
@@ -0,0 +1,349 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "math_util.h"
+#include "flight_batch.h"
+#include "flight_control.h"
+#include "flight_physics.h"
+#include "flight_run.h"
+
+
+// Initial states for the run() benchmarks. The first is the one in the comments
+// in run(), the rest cover a level start, a high slow start and a deep fast start.
+static const struct {
+    const char *name;
+    u32 posY;
+    u32 forwardVel;
+    s16 pitch;
+    s16 pitchVel;
+} sRunStates[] = {
+    { "reference", 0xC4C1F742, 0x42C7CD92, -10922, 0 },
+    { "level",     0x00000000, 0x42C80000, 0, 0 },
+    { "high",      0x44FA0000, 0x42700000, 0x1000, -0x100 },
+    { "deep",      0xC5000000, 0x42A00000, -0x2000, 0x200 },
+};
+
+struct Benchmark
+{
+    const char *name;
+    const char *unit;
+    // Runs one repetition and returns the number of units it did
+    s64 (*fn)(const void *arg);
+    const void *arg;
+};
+
+static volatile f32 sSink;
+static u32 sSeed;
+
+static u32 bench_random(void) {
+    sSeed = sSeed * 1664525 + 1013904223;
+    return sSeed >> 8;
+}
+
+static f64 now_seconds(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void load_run_state(struct MarioState *m, s32 index) {
+    clear_mario_state(m);
+    memcpy(&m->pos[1], &sRunStates[index].posY, sizeof(f32));
+    memcpy(&m->forwardVel, &sRunStates[index].forwardVel, sizeof(f32));
+    m->faceAngle[0] = sRunStates[index].pitch;
+    m->angleVel[0] = sRunStates[index].pitchVel;
+}
+
+// A flying state like the ones run() visits: climbing or diving at 30-130 speed
+static void random_flight_state(struct MarioState *m) {
+    clear_mario_state(m);
+    m->pos[1] = (f32)(s32)(bench_random() % 8000) - 4000.0f;
+    m->forwardVel = 30.0f + (f32)(bench_random() % 100000) / 1000.0f;
+    m->faceAngle[0] = (s32)(bench_random() % 0x5555) - 0x2AAA;
+    m->angleVel[0] = (s32)(bench_random() % 0x800) - 0x400;
+}
+
+
+static s64 bench_run(const void *arg) {
+    s32 index = (s32)(size_t) arg;
+    struct MarioState m;
+    struct Controller c;
+
+    m.controller = &c;
+    load_run_state(&m, index);
+    sSink = run(&m, NULL, FALSE, NULL);
+    return 15000;
+}
+
+static s64 bench_act_flying(const void *arg) {
+    (void) arg;
+    enum { NUM_FRAMES = 2000000 };
+    struct MarioState m;
+    struct Controller c;
+
+    m.controller = &c;
+    sSeed = 1;
+    random_flight_state(&m);
+    for (s32 i = 0; i < NUM_FRAMES; i++) {
+        adjust_analog_stick(m.controller, 0, (s32)(i & 0xFF) - 128);
+        act_flying(&m, TRUE);
+        if (m.forwardVel < 10.0f) {
+            random_flight_state(&m);
+        }
+    }
+    sSink = m.pos[1];
+    return NUM_FRAMES;
+}
+
+static s64 bench_pitch_vel_for_pitch(const void *arg) {
+    (void) arg;
+    enum { NUM_CALLS = 20000 };
+    struct MarioState m;
+    struct Controller c;
+    f32 sum = 0;
+
+    m.controller = &c;
+    sSeed = 2;
+    for (s32 i = 0; i < NUM_CALLS; i++) {
+        random_flight_state(&m);
+        sum += pitch_vel_for_pitch(&m, i % 2 == 0 ? 0x1200 : -0x2AAA);
+    }
+    sSink = sum;
+    return NUM_CALLS;
+}
+
+static s64 bench_min_pitch_vel_disp(const void *arg) {
+    (void) arg;
+    enum { NUM_STATES = 1000 };
+    struct MarioState m;
+    struct Controller c;
+    s32 sum = 0;
+
+    m.controller = &c;
+    sSeed = 3;
+    for (s32 i = 0; i < NUM_STATES; i++) {
+        random_flight_state(&m);
+        for (s32 pv = -0x400; pv < 0x400; pv++) {
+            sum += min_pitch_vel_disp(&m, pv);
+        }
+    }
+    sSink = sum;
+    return NUM_STATES * 0x800;
+}
+
+static s64 bench_approach_pitch_vel_raw_stick_y(const void *arg) {
+    (void) arg;
+    enum { NUM_CALLS = 1000000 };
+    struct MarioState m;
+    struct Controller c;
+    s32 sum = 0;
+
+    m.controller = &c;
+    sSeed = 4;
+    for (s32 i = 0; i < NUM_CALLS; i++) {
+        if (i % 64 == 0) {
+            random_flight_state(&m);
+        }
+        sum += approach_pitch_vel_raw_stick_y(&m, (s32)(bench_random() % 0x800) - 0x400);
+    }
+    sSink = sum;
+    return NUM_CALLS;
+}
+
+static s64 bench_max_possible_min_y(const void *arg) {
+    (void) arg;
+    enum { NUM_CALLS = 200000 };
+    struct MarioState m;
+    struct Controller c;
+    f32 sum = 0;
+
+    m.controller = &c;
+    sSeed = 5;
+    for (s32 i = 0; i < NUM_CALLS; i++) {
+        random_flight_state(&m);
+        sum += max_possible_min_y(&m);
+    }
+    sSink = sum;
+    return NUM_CALLS;
+}
+
+static s64 bench_atan2s(const void *arg) {
+    (void) arg;
+    enum { NUM_CALLS = 5000000 };
+    s32 sum = 0;
+
+    sSeed = 6;
+    for (s32 i = 0; i < NUM_CALLS; i++) {
+        f32 a = (f32)(s32)(bench_random() % 20001) - 10000.0f;
+        f32 b = (f32)(s32)(bench_random() % 20001) - 10000.0f;
+        sum += atan2s(a, b);
+    }
+    sSink = sum;
+    return NUM_CALLS;
+}
+
+// Does the same work per state-frame as bench_act_flying, adjust_analog_stick
+// included, so the rates compare directly
+static s64 bench_batch(const void *arg) {
+    enum { NUM_STATES = 4096, NUM_FRAMES = 2000 };
+    s32 kernel = (s32)(size_t) arg;
+    struct FlightBatch b;
+    struct Controller c;
+
+    flight_batch_set_kernel(kernel);
+    flight_batch_init(&b, NUM_STATES);
+    for (s32 i = 0; i < NUM_STATES; i++) {
+        b.forwardVel[i] = 100.0f + i % 50;
+        b.faceAngle[0][i] = i * 5 - 0x2000;
+    }
+
+    for (s32 frame = 0; frame < NUM_FRAMES; frame++) {
+        for (s32 i = 0; i < NUM_STATES; i++) {
+            adjust_analog_stick(&c, 0, (s32)((i + frame) & 0xFF) - 128);
+            b.stickX[i] = c.stickX;
+            b.stickY[i] = c.stickY;
+        }
+        flight_batch_step(&b, TRUE);
+    }
+
+    sSink = b.posY[0];
+    flight_batch_free(&b);
+    return (s64) NUM_STATES * NUM_FRAMES;
+}
+
+
+static s32 compare_f64(const void *a, const void *b) {
+    f64 x = *(const f64 *) a;
+    f64 y = *(const f64 *) b;
+    return (x > y) - (x < y);
+}
+
+struct BenchStats
+{
+    f64 min;
+    f64 median;
+    f64 mean;
+    f64 stddev;
+    f64 max;
+};
+
+static void compute_stats(f64 *rates, s32 count, struct BenchStats *stats) {
+    qsort(rates, count, sizeof(f64), compare_f64);
+
+    stats->min = rates[0];
+    stats->max = rates[count - 1];
+    stats->median = count % 2 == 1 ? rates[count / 2] : (rates[count / 2 - 1] + rates[count / 2]) / 2;
+
+    stats->mean = 0;
+    for (s32 i = 0; i < count; i++) {
+        stats->mean += rates[i];
+    }
+    stats->mean /= count;
+
+    stats->stddev = 0;
+    for (s32 i = 0; i < count; i++) {
+        stats->stddev += sqr(rates[i] - stats->mean);
+    }
+    stats->stddev = count > 1 ? sqrt(stats->stddev / (count - 1)) : 0;
+}
+
+static void usage(void) {
+    printf("usage: flight_bench [--reps N] [--filter SUBSTRING] [--json] [--list]\n");
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    static char runNames[sizeof(sRunStates) / sizeof(sRunStates[0])][32];
+    static char batchNames[FLIGHT_KERNEL_COUNT][32];
+    struct Benchmark benchmarks[32];
+    s32 numBenchmarks = 0;
+
+    for (s32 i = 0; i < (s32)(sizeof(sRunStates) / sizeof(sRunStates[0])); i++) {
+        snprintf(runNames[i], sizeof(runNames[i]), "run/%s", sRunStates[i].name);
+        benchmarks[numBenchmarks++] = (struct Benchmark) { runNames[i], "frames", bench_run, (void *)(size_t) i };
+    }
+    benchmarks[numBenchmarks++] = (struct Benchmark) { "act_flying", "frames", bench_act_flying, NULL };
+    benchmarks[numBenchmarks++] = (struct Benchmark) { "pitch_vel_for_pitch", "calls", bench_pitch_vel_for_pitch, NULL };
+    benchmarks[numBenchmarks++] = (struct Benchmark) { "min_pitch_vel_disp", "calls", bench_min_pitch_vel_disp, NULL };
+    benchmarks[numBenchmarks++] = (struct Benchmark) { "approach_pitch_vel_raw_stick_y", "calls", bench_approach_pitch_vel_raw_stick_y, NULL };
+    benchmarks[numBenchmarks++] = (struct Benchmark) { "max_possible_min_y", "calls", bench_max_possible_min_y, NULL };
+    benchmarks[numBenchmarks++] = (struct Benchmark) { "atan2s", "calls", bench_atan2s, NULL };
+    for (s32 k = 0; k < FLIGHT_KERNEL_COUNT; k++) {
+        if (flight_batch_kernel_supported(k)) {
+            snprintf(batchNames[k], sizeof(batchNames[k]), "batch/%s", flight_batch_kernel_name(k));
+            benchmarks[numBenchmarks++] = (struct Benchmark) { batchNames[k], "state-frames", bench_batch, (void *)(size_t) k };
+        }
+    }
+
+    s32 reps = 5;
+    const char *filter = NULL;
+    s32 json = FALSE;
+
+    for (s32 i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = TRUE;
+        } else if (strcmp(argv[i], "--list") == 0) {
+            for (s32 b = 0; b < numBenchmarks; b++) {
+                printf("%s\n", benchmarks[b].name);
+            }
+            return 0;
+        } else {
+            usage();
+        }
+    }
+    if (reps < 1) {
+        usage();
+    }
+
+    if (json) {
+        printf("{\"compiler\": \"%s\", \"reps\": %d, \"benchmarks\": [", __VERSION__, reps);
+    } else {
+        printf("%-32s %14s %14s %14s %8s  %s\n", "benchmark", "median/s", "min/s", "max/s", "stddev", "unit");
+    }
+
+    s32 first = TRUE;
+    for (s32 b = 0; b < numBenchmarks; b++) {
+        struct Benchmark *bench = &benchmarks[b];
+        if (filter != NULL && strstr(bench->name, filter) == NULL) {
+            continue;
+        }
+
+        // One untimed repetition to warm caches and build lookup tables
+        bench->fn(bench->arg);
+
+        f64 rates[reps];
+        for (s32 r = 0; r < reps; r++) {
+            f64 start = now_seconds();
+            s64 units = bench->fn(bench->arg);
+            rates[r] = units / (now_seconds() - start);
+        }
+
+        struct BenchStats stats;
+        compute_stats(rates, reps, &stats);
+
+        if (json) {
+            printf("%s\n  {\"name\": \"%s\", \"unit\": \"%s\", \"median\": %.1f, \"mean\": %.1f, "
+                "\"min\": %.1f, \"max\": %.1f, \"stddev\": %.1f}",
+                first ? "" : ",", bench->name, bench->unit,
+                stats.median, stats.mean, stats.min, stats.max, stats.stddev);
+        } else {
+            printf("%-32s %14.0f %14.0f %14.0f %7.1f%%  %s\n", bench->name, stats.median, stats.min,
+                stats.max, 100 * stats.stddev / stats.mean, bench->unit);
+        }
+        fflush(stdout);
+        first = FALSE;
+    }
+
+    if (json) {
+        printf("\n]}\n");
+    }
+
+    return 0;
+}
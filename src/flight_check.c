@@ -0,0 +1,1130 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "flight_check.h"
+#include "cmaes.h"
+#include "flight_batch.h"
+#include "flight_beam.h"
+#include "flight_control.h"
+#include "flight_cycle.h"
+#include "flight_mcts.h"
+#include "flight_prune.h"
+#include "flight_sweep.h"
+#include "math_tables.h"
+#include "pareto.h"
+#include "tas_inputs.h"
+#include "transposition.h"
+#include "work_pool.h"
+
+
+static u32 sCheckSeed = 1;
+
+static u32 check_random(void) {
+    sCheckSeed = sCheckSeed * 1664525 + 1013904223;
+    return sCheckSeed >> 8;
+}
+
+// Creates an empty file in the temp directory for a check to write to
+static void make_temp_path(char *path, size_t size) {
+    const char *dir = getenv("TMPDIR");
+    snprintf(path, size, "%s/flight_check_XXXXXX", dir != NULL && dir[0] != '\0' ? dir : "/tmp");
+    s32 fd = mkstemp(path);
+    if (fd < 0) {
+        printf("Failed to create %s\n", path);
+        exit(1);
+    }
+    close(fd);
+}
+
+static void randomize_mario_state(struct MarioState *m) {
+    clear_mario_state(m);
+    m->pos[1] = (f32)(s32)(check_random() % 20000) - 10000.0f + (f32)(check_random() % 1000) / 1000.0f;
+    m->forwardVel = (f32)(check_random() % 300) + (f32)(check_random() % 1000) / 1000.0f;
+    m->faceAngle[0] = (s32)(check_random() % 0x5555) - 0x2AAA;
+    m->faceAngle[1] = check_random();
+    m->angleVel[0] = (s32)(check_random() % 0x800) - 0x400;
+    m->angleVel[1] = (s32)(check_random() % 0x200) - 0x100;
+}
+
+static s32 batch_lane_matches(struct FlightBatch *b, s32 i, struct MarioState *m) {
+    return memcmp(&b->posY[i], &m->pos[1], sizeof(f32)) == 0
+        && memcmp(&b->forwardVel[i], &m->forwardVel, sizeof(f32)) == 0
+        && b->faceAngle[0][i] == m->faceAngle[0]
+        && b->faceAngle[1][i] == m->faceAngle[1]
+        && b->faceAngle[2][i] == m->faceAngle[2]
+        && b->angleVel[0][i] == m->angleVel[0]
+        && b->angleVel[1][i] == m->angleVel[1];
+}
+
+static void copy_mario_state_to_batch(struct FlightBatch *b, s32 i, struct MarioState *m) {
+    b->posY[i] = m->pos[1];
+    b->forwardVel[i] = m->forwardVel;
+    b->faceAngle[0][i] = m->faceAngle[0];
+    b->faceAngle[1][i] = m->faceAngle[1];
+    b->faceAngle[2][i] = m->faceAngle[2];
+    b->angleVel[0][i] = m->angleVel[0];
+    b->angleVel[1][i] = m->angleVel[1];
+}
+
+// The generated tables have to be the N64's, and sins, coss and the pitch table
+// have to give the same values as gSineTable for every angle they cover
+static s32 check_math_tables(void) {
+    s32 ok = TRUE;
+
+    ok &= checkpoint_hash(CHECKPOINT_HASH_INIT, gSineTable, SINE_TABLE_SIZE * sizeof(f32)) == SINE_TABLE_HASH;
+    ok &= checkpoint_hash(CHECKPOINT_HASH_INIT, D_8038B000, ARCTAN_TABLE_SIZE * sizeof(s16)) == ARCTAN_TABLE_HASH;
+
+    for (s32 angle = -0x8000; angle < 0x8000; angle++) {
+        ok &= memcmp(&sins(angle), &gSineTable[(u16) angle >> 4], sizeof(f32)) == 0;
+        ok &= memcmp(&coss(angle), &gSineTable[(u16) (angle + 0x4000) >> 4], sizeof(f32)) == 0;
+    }
+    for (s32 pitch = -0x2AAA; pitch <= 0x2AAA; pitch++) {
+        ok &= memcmp(&sins_pitch(pitch), &gSineTable[(u16) pitch >> 4], sizeof(f32)) == 0;
+        ok &= memcmp(&coss_pitch(pitch), &gSineTable[(u16) (pitch + 0x4000) >> 4], sizeof(f32)) == 0;
+    }
+
+    printf("math tables %s\n", ok ? "ok" : "FAILED");
+    return !ok;
+}
+
+// pitch_drag has to match the game's expression for every pitch
+static s32 check_pitch_drag(void) {
+    s32 ok = TRUE;
+    for (s32 pitch = -0x8000; pitch < 0x8000; pitch++) {
+        f32 expected = 2.0f * ((f32) pitch / 0x4000) + 0.1f;
+        f32 drag = pitch_drag(pitch);
+        ok &= memcmp(&drag, &expected, sizeof(f32)) == 0;
+    }
+
+    printf("pitch drag %s\n", ok ? "ok" : "FAILED");
+    return !ok;
+}
+
+// Differential test of every supported batch kernel against act_flying, on random
+// states and random raw sticks. Returns the number of failing kernels.
+// Every array of a batch has to be zeroed, 32 byte aligned, padded to a multiple
+// of FLIGHT_BATCH_ALIGN and clear of the others, and so do views into it
+static s32 check_flight_batch_layout(void) {
+    const s32 counts[] = { 0, 1, 7, FLIGHT_BATCH_ALIGN, FLIGHT_BATCH_ALIGN + 1, 1003 };
+    s32 ok = TRUE;
+
+    for (u32 c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        struct FlightBatch b, view;
+        flight_batch_init(&b, counts[c]);
+        ok &= b.count == counts[c] && b.capacity >= max(counts[c], 1) && b.capacity % FLIGHT_BATCH_ALIGN == 0;
+
+        for (s32 start = 0; start < b.capacity; start += FLIGHT_BATCH_ALIGN) {
+            flight_batch_view(&view, &b, start, b.capacity - start);
+            const void *f32Arrays[] = { view.posY, view.forwardVel, view.stickX, view.stickY };
+            const void *s16Arrays[] = { view.faceAngle[0], view.faceAngle[1], view.faceAngle[2], view.angleVel[0],
+                view.angleVel[1] };
+            for (s32 i = 0; i < 4; i++) {
+                ok &= (size_t) f32Arrays[i] % 32 == 0;
+            }
+            for (s32 i = 0; i < 5; i++) {
+                ok &= (size_t) s16Arrays[i] % 32 == 0;
+            }
+        }
+
+        // Laid out back to back in one block, so no array runs into the next
+        const u8 *arrays[] = { (u8 *) b.posY, (u8 *) b.forwardVel, (u8 *) b.stickX, (u8 *) b.stickY,
+            (u8 *) b.faceAngle[0], (u8 *) b.faceAngle[1], (u8 *) b.faceAngle[2], (u8 *) b.angleVel[0],
+            (u8 *) b.angleVel[1] };
+        for (s32 i = 0; i < 8; i++) {
+            ok &= arrays[i + 1] - arrays[i] >= b.capacity * (i < 4 ? (s32) sizeof(f32) : (s32) sizeof(s16));
+        }
+        for (s32 i = 0; i < b.capacity; i++) {
+            ok &= b.posY[i] == 0.0f && b.forwardVel[i] == 0.0f && b.stickX[i] == 0.0f && b.stickY[i] == 0.0f;
+            ok &= b.faceAngle[0][i] == 0 && b.faceAngle[1][i] == 0 && b.faceAngle[2][i] == 0;
+            ok &= b.angleVel[0][i] == 0 && b.angleVel[1][i] == 0;
+        }
+        flight_batch_free(&b);
+    }
+
+    printf("batch layout %s\n", ok ? "ok" : "FAILED");
+    return !ok;
+}
+
+static s32 check_flight_batch(void) {
+    enum { NUM_STATES = 1003, NUM_FRAMES = 2000 };
+    static struct MarioState states[NUM_STATES];
+    static struct Controller controllers[NUM_STATES];
+    s32 failures = 0;
+
+    for (s32 kernel = 0; kernel < FLIGHT_KERNEL_COUNT; kernel++) {
+        if (!flight_batch_set_kernel(kernel)) {
+            printf("batch %-8s skipped (unsupported)\n", flight_batch_kernel_name(kernel));
+            continue;
+        }
+
+        struct FlightBatch b;
+        flight_batch_init(&b, NUM_STATES);
+
+        sCheckSeed = 1;
+        for (s32 i = 0; i < NUM_STATES; i++) {
+            states[i].controller = &controllers[i];
+            randomize_mario_state(&states[i]);
+            copy_mario_state_to_batch(&b, i, &states[i]);
+        }
+
+        s64 mismatches = 0;
+        for (s32 frame = 0; frame < NUM_FRAMES; frame++) {
+            s32 downTilt = frame % 3 != 0;
+
+            for (s32 i = 0; i < NUM_STATES; i++) {
+                struct MarioState *m = &states[i];
+                adjust_analog_stick(m->controller, (s32)(check_random() & 0xFF) - 128,
+                                    (s32)(check_random() & 0xFF) - 128);
+                b.stickX[i] = m->controller->stickX;
+                b.stickY[i] = m->controller->stickY;
+                act_flying(m, downTilt);
+            }
+
+            flight_batch_step(&b, downTilt);
+
+            for (s32 i = 0; i < NUM_STATES; i++) {
+                if (!batch_lane_matches(&b, i, &states[i])) {
+                    if (mismatches == 0) {
+                        printf("batch %s: first mismatch at frame %d lane %d: y = %f vs %f, v = %f vs %f\n",
+                            flight_batch_kernel_name(kernel), frame, i,
+                            b.posY[i], states[i].pos[1], b.forwardVel[i], states[i].forwardVel);
+                    }
+                    mismatches += 1;
+                }
+
+                // Keep states in the range that flight actually visits
+                if (states[i].forwardVel == 0.0f || abs(states[i].pos[1]) > 100000.0f)
+                    randomize_mario_state(&states[i]);
+                copy_mario_state_to_batch(&b, i, &states[i]);
+            }
+        }
+
+        printf("batch %-8s %s (%d states x %d frames)\n", flight_batch_kernel_name(kernel),
+            mismatches == 0 ? "ok" : "FAILED", NUM_STATES, NUM_FRAMES);
+        if (mismatches != 0)
+            failures += 1;
+
+        flight_batch_free(&b);
+    }
+
+    return failures;
+}
+
+
+// Compares pitch_vel_for_pitch against the brute force scan on random states in
+// all three speed jerk regimes. Returns the number of mismatches.
+static s32 check_pitch_vel_for_pitch(void) {
+    enum { NUM_CASES = 20000 };
+    struct MarioState m;
+    struct Controller c;
+    s32 mismatches = 0;
+
+    m.controller = &c;
+    sCheckSeed = 2;
+    for (s32 i = 0; i < NUM_CASES; i++) {
+        randomize_mario_state(&m);
+        switch (i % 4) {
+        case 0:
+            m.forwardVel = (f32)(check_random() % 4000) / 1000.0f;
+            break;
+        case 1:
+            m.forwardVel = 4.0f + (f32)(check_random() % 12000) / 1000.0f;
+            break;
+        }
+
+        s32 targetPitch = i % 3 == 0 ? 0x1200 : i % 3 == 1 ? -0x2AAA : (s32)(check_random() % 0x10000) - 0x8000;
+        f32 expected = pitch_vel_for_pitch_brute(&m, targetPitch);
+        f32 actual = pitch_vel_for_pitch(&m, targetPitch);
+        if (expected != actual) {
+            if (mismatches == 0) {
+                printf("pitch_vel_for_pitch: v = %f, p = %d, target = %d: %f vs %f\n",
+                    m.forwardVel, m.faceAngle[0], targetPitch, actual, expected);
+            }
+            mismatches += 1;
+        }
+    }
+
+    printf("pitch_vel_for_pitch %s (%d cases)\n", mismatches == 0 ? "ok" : "FAILED", NUM_CASES);
+    return mismatches;
+}
+
+// Compares the closed forms of min_pitch_vel_disp and halting_pitch against their
+// loops for every pitch vel in [-0x400, 0x400), at speeds covering every
+// truncated jerk value up to 300 speed (steps of 1/16 move the jerk by at most
+// 0.625) plus random speeds.
+static s32 check_pitch_vel_closed_forms(void) {
+    enum { NUM_RANDOM_SPEEDS = 5000 };
+    s32 numGridSpeeds = 300 * 16;
+    struct MarioState m;
+    struct Controller c;
+    s32 dispMismatches = 0;
+    s32 haltingMismatches = 0;
+
+    m.controller = &c;
+    clear_mario_state(&m);
+    sCheckSeed = 3;
+
+    for (s32 i = 0; i < numGridSpeeds + NUM_RANDOM_SPEEDS; i++) {
+        if (i < numGridSpeeds) {
+            m.forwardVel = (f32) i / 16;
+        } else {
+            u32 bits = 0x40800000 + check_random() % 0x03000000; // 4.0 to ~512.0
+            memcpy(&m.forwardVel, &bits, sizeof(f32));
+        }
+
+        for (s32 pv = -0x400; pv < 0x400; pv++) {
+            if (min_pitch_vel_disp(&m, pv) != min_pitch_vel_disp_loop(&m, pv)) {
+                if (dispMismatches == 0) {
+                    printf("min_pitch_vel_disp: v = %a, pv = %d: %d vs %d\n", m.forwardVel, pv,
+                        min_pitch_vel_disp(&m, pv), min_pitch_vel_disp_loop(&m, pv));
+                }
+                dispMismatches += 1;
+            }
+
+            m.angleVel[0] = pv;
+            if (halting_pitch(&m) != halting_pitch_loop(&m)) {
+                if (haltingMismatches == 0) {
+                    printf("halting_pitch: v = %a, pv = %d: %d vs %d\n", m.forwardVel, pv,
+                        halting_pitch(&m), halting_pitch_loop(&m));
+                }
+                haltingMismatches += 1;
+            }
+        }
+    }
+
+    printf("min_pitch_vel_disp %s (%d speeds)\n", dispMismatches == 0 ? "ok" : "FAILED",
+        numGridSpeeds + NUM_RANDOM_SPEEDS);
+    printf("halting_pitch %s (%d speeds)\n", haltingMismatches == 0 ? "ok" : "FAILED",
+        numGridSpeeds + NUM_RANDOM_SPEEDS);
+    return dispMismatches + haltingMismatches;
+}
+
+// Compares approach_pitch_vel_raw_stick_y against the scan over all 256 raw sticks
+static s32 check_approach_pitch_vel_raw_stick_y(void) {
+    enum { NUM_SPEEDS = 1000 };
+    struct MarioState m;
+    struct Controller c;
+    s32 mismatches = 0;
+
+    m.controller = &c;
+    clear_mario_state(&m);
+    sCheckSeed = 4;
+
+    for (s32 i = 0; i < NUM_SPEEDS; i++) {
+        m.forwardVel = i < 600 ? (f32) i / 2 : (f32)(check_random() % 300000) / 1000.0f;
+
+        for (s32 target = -0x400; target < 0x400; target++) {
+            s16 expected = approach_pitch_vel_raw_stick_y_scan(&m, target);
+            s16 actual = approach_pitch_vel_raw_stick_y(&m, target);
+            if (expected != actual) {
+                if (mismatches == 0) {
+                    printf("approach_pitch_vel_raw_stick_y: v = %f, target = %d: %d vs %d\n",
+                        m.forwardVel, target, actual, expected);
+                }
+                mismatches += 1;
+            }
+        }
+    }
+
+    printf("approach_pitch_vel_raw_stick_y %s (%d speeds)\n", mismatches == 0 ? "ok" : "FAILED", NUM_SPEEDS);
+    return mismatches;
+}
+
+static s32 mario_states_match(struct MarioState *a, struct MarioState *b) {
+    return memcmp(&a->pos[1], &b->pos[1], sizeof(f32)) == 0
+        && memcmp(&a->forwardVel, &b->forwardVel, sizeof(f32)) == 0
+        && memcmp(a->faceAngle, b->faceAngle, sizeof(Vec3s)) == 0
+        && memcmp(a->angleVel, b->angleVel, sizeof(Vec3s)) == 0;
+}
+
+// Steps random states with all 256 raw sticks and checks that
+// distinct_pitch_vel_inputs finds exactly the distinct next states, each with its
+// smallest raw stick
+static s32 check_distinct_pitch_vel_inputs(void) {
+    enum { NUM_STATES = 5000 };
+    struct MarioState m, next[256];
+    struct Controller c, nextControllers[256];
+    struct PitchVelInput inputs[256];
+    s32 mismatches = 0;
+    s64 totalInputs = 0;
+
+    m.controller = &c;
+    sCheckSeed = 5;
+
+    for (s32 i = 0; i < NUM_STATES; i++) {
+        randomize_mario_state(&m);
+        s32 count = distinct_pitch_vel_inputs(&m, inputs);
+        totalInputs += count;
+
+        for (s32 raw = -128; raw < 128; raw++) {
+            struct MarioState *n = &next[raw + 128];
+            *n = m;
+            n->controller = &nextControllers[raw + 128];
+            adjust_analog_stick(n->controller, 0, raw);
+            act_flying(n, TRUE);
+        }
+
+        s32 ok = TRUE;
+        s32 numDistinct = 0;
+        for (s32 raw = -128; raw < 128; raw++) {
+            s32 first = TRUE;
+            for (s32 r = -128; r < raw && first; r++) {
+                first = !mario_states_match(&next[r + 128], &next[raw + 128]);
+            }
+            numDistinct += first;
+
+            s32 found = FALSE;
+            for (s32 k = 0; k < count; k++) {
+                if (inputs[k].pitchVel == next[raw + 128].angleVel[0]) {
+                    found = TRUE;
+                    ok = ok && inputs[k].rawStickY <= raw
+                        && mario_states_match(&next[inputs[k].rawStickY + 128], &next[raw + 128]);
+                }
+            }
+            ok = ok && found;
+        }
+        ok = ok && numDistinct == count;
+
+        if (!ok) {
+            if (mismatches == 0) {
+                printf("distinct_pitch_vel_inputs: v = %f, pv = %d: %d inputs, %d distinct states\n",
+                    m.forwardVel, m.angleVel[0], count, numDistinct);
+            }
+            mismatches += 1;
+        }
+    }
+
+    printf("distinct_pitch_vel_inputs %s (%d states, %.1f inputs per state)\n",
+        mismatches == 0 ? "ok" : "FAILED", NUM_STATES, (f64) totalInputs / NUM_STATES);
+    return mismatches;
+}
+
+// Flies random states with random sticks and with the hardest pull up, and checks
+// that nothing gets higher, faster or stays higher than the prune bounds allow
+static s32 check_prune_bounds(void) {
+    enum { NUM_STATES = 20000, NUM_FRAMES = 300 };
+    struct MarioState start, m;
+    struct Controller c;
+    s32 violations = 0;
+
+    start.controller = &c;
+    sCheckSeed = 7;
+
+    for (s32 i = 0; i < NUM_STATES; i++) {
+        randomize_mario_state(&start);
+        start.faceAngle[1] = 0;
+        start.angleVel[1] = 0;
+
+        f32 minYBound = min_y_bound(start.pos[1], start.forwardVel, start.faceAngle[0], start.angleVel[0]);
+        s32 pullUp = i % 2 == 0;
+        s32 descending = TRUE;
+        f32 minY = start.pos[1];
+        f32 maxY = start.pos[1];
+
+        m = start;
+        for (s32 frame = 1; frame <= NUM_FRAMES; frame++) {
+            adjust_analog_stick(m.controller, 0, pullUp ? -128 : (s32)(check_random() & 0xFF) - 128);
+            act_flying(&m, TRUE);
+            maxY = max(maxY, m.pos[1]);
+
+            // Only the hardest pull up has to stay above the min y bound
+            descending = descending && m.vel[1] < 0;
+            if (pullUp && descending) {
+                minY = min(minY, m.pos[1]);
+            }
+
+            if (frame % 10 == 0 || frame == 1) {
+                f32 yBound = max_y_bound(start.pos[1], start.forwardVel, start.faceAngle[0], frame);
+                f32 speedBound = max_speed_bound(start.forwardVel, start.faceAngle[0], frame);
+                if (maxY > yBound || m.forwardVel > speedBound) {
+                    if (violations == 0) {
+                        printf("prune bounds: frame %d: y %f > %f or v %f > %f\n", frame, maxY, yBound,
+                            m.forwardVel, speedBound);
+                    }
+                    violations += 1;
+                    break;
+                }
+            }
+        }
+
+        if (pullUp && minY > minYBound) {
+            if (violations == 0) {
+                printf("prune bounds: v = %f, p = %d, pv = %d: min y %f > %f\n", start.forwardVel,
+                    start.faceAngle[0], start.angleVel[0], minY, minYBound);
+            }
+            violations += 1;
+        }
+    }
+
+    printf("prune_bounds %s (%d states x %d frames)\n", violations == 0 ? "ok" : "FAILED", NUM_STATES, NUM_FRAMES);
+    return violations;
+}
+
+// Fills a transposition table to about 15% and checks that every key is found,
+// that new keys aren't, and the frame rules, for visits and for separate
+// lookups and inserts
+static s32 check_transposition_table(void) {
+    enum { NUM_KEYS = 20000 };
+    static struct FlightKey keys[NUM_KEYS];
+    struct TranspositionTable t;
+    s32 errors = 0;
+
+    transposition_init(&t, 4 << 20);
+    sCheckSeed = 6;
+    for (s32 i = 0; i < NUM_KEYS; i++) {
+        keys[i].posY = check_random() ^ check_random() << 8;
+        keys[i].forwardVel = check_random() ^ check_random() << 8;
+        keys[i].pitch = check_random();
+        keys[i].pitchVel = check_random();
+        keys[i].yaw = 0;
+        keys[i].yawVel = 0;
+    }
+
+    for (s32 i = 0; i < NUM_KEYS / 2; i++) {
+        errors += transposition_visit(&t, &keys[i], 10) != FALSE;
+    }
+    for (s32 i = 0; i < NUM_KEYS / 2; i++) {
+        // Seen at frame 10, so a hit at 10 or later but new at 9
+        errors += transposition_visit(&t, &keys[i], 10 + i % 2) != TRUE;
+    }
+    for (s32 i = NUM_KEYS / 2; i < NUM_KEYS; i++) {
+        errors += transposition_visit(&t, &keys[i], 10) != FALSE;
+    }
+    errors += transposition_visit(&t, &keys[0], 9) != FALSE;
+    errors += transposition_visit(&t, &keys[0], 9) != TRUE;
+
+    // Looking a key up doesn't record it, and inserting it later doesn't move it
+    // to a later frame
+    struct FlightKey key = keys[1];
+    key.yaw = 1;
+    u64 hash = flight_key_hash(&key);
+    errors += transposition_contains_hashed(&t, &key, hash, 20) != FALSE;
+    errors += transposition_contains_hashed(&t, &key, hash, 20) != FALSE;
+    transposition_insert_hashed(&t, &key, hash, 12);
+    transposition_insert_hashed(&t, &key, hash, 15);
+    errors += transposition_contains_hashed(&t, &key, hash, 11) != FALSE;
+    errors += transposition_contains_hashed(&t, &key, hash, 12) != TRUE;
+
+    printf("transposition_table %s (%d keys, %lld replacements)\n", errors == 0 ? "ok" : "FAILED", NUM_KEYS,
+        (long long) t.replacements);
+    transposition_free(&t);
+    return errors;
+}
+
+struct WorkPoolCheck
+{
+    _Atomic s32 *calls;
+    s32 numThreads;
+    _Atomic s32 badThreads;
+};
+
+static void count_work_call(void *arg, s32 index, s32 thread) {
+    struct WorkPoolCheck *w = arg;
+    w->calls[index] += 1;
+    if (thread < 0 || thread >= w->numThreads) {
+        w->badThreads += 1;
+    }
+}
+
+// The pool's threads outlive each call, so run many small batches back to back
+// with thread counts going up and down, and count the calls for each index
+static s32 check_work_pool(void) {
+    enum { MAX_COUNT = 300, NUM_BATCHES = 2000 };
+    static _Atomic s32 calls[MAX_COUNT];
+    struct WorkPoolCheck w = { calls, 0, 0 };
+    s32 ok = TRUE;
+
+    for (s32 batch = 0; ok && batch < NUM_BATCHES; batch++) {
+        s32 count = check_random() % MAX_COUNT;
+        w.numThreads = 1 + check_random() % 8;
+        for (s32 i = 0; i < count; i++) {
+            calls[i] = 0;
+        }
+
+        work_pool_run(count, w.numThreads, count_work_call, &w);
+
+        for (s32 i = 0; i < count; i++) {
+            ok &= calls[i] == 1;
+        }
+        ok &= w.badThreads == 0;
+    }
+
+    printf("work pool %s (%d batches)\n", ok ? "ok" : "FAILED", NUM_BATCHES);
+    return !ok;
+}
+
+static void count_frontier_point(void *arg, s32 id) {
+    ((s32 *) arg)[id] += 1;
+}
+
+// Fills a Pareto frontier with random points on a coarse grid, so ties are
+// common, and compares it to a brute force search for the non-dominated ones
+static s32 check_pareto_frontier(void) {
+    enum { NUM_POINTS = 20000, NUM_KEYS = 3000 };
+    static struct { s32 key; f32 posY, forwardVel; } points[NUM_POINTS];
+    static s32 seen[NUM_POINTS];
+    struct ParetoFrontier f;
+    s32 errors = 0;
+
+    pareto_init(&f);
+    sCheckSeed = 9;
+    for (s32 i = 0; i < NUM_POINTS; i++) {
+        points[i].key = check_random() % NUM_KEYS;
+        points[i].posY = (f32)(check_random() % 100);
+        points[i].forwardVel = (f32)(check_random() % 100);
+        seen[i] = 0;
+        pareto_insert(&f, points[i].key, -points[i].key, points[i].posY, points[i].forwardVel, i);
+    }
+    pareto_for_each(&f, count_frontier_point, seen);
+
+    // Sort point ids by key so the brute force only compares within a key
+    static s32 order[NUM_POINTS];
+    static s32 first[NUM_KEYS + 1];
+    memset(first, 0, sizeof(first));
+    for (s32 i = 0; i < NUM_POINTS; i++) {
+        first[points[i].key + 1] += 1;
+    }
+    for (s32 k = 0; k < NUM_KEYS; k++) {
+        first[k + 1] += first[k];
+    }
+    for (s32 i = 0; i < NUM_POINTS; i++) {
+        order[first[points[i].key]++] = i;
+    }
+    for (s32 k = NUM_KEYS; k > 0; k--) {
+        first[k] = first[k - 1];
+    }
+    first[0] = 0;
+
+    s32 frontierSize = 0;
+    for (s32 k = 0; k < NUM_KEYS; k++) {
+        for (s32 x = first[k]; x < first[k + 1]; x++) {
+            s32 i = order[x];
+            f32 yi = points[i].posY;
+            f32 vi = points[i].forwardVel;
+
+            // The earliest of equal points is the one kept
+            s32 dominated = FALSE;
+            for (s32 z = first[k]; z < first[k + 1] && !dominated; z++) {
+                s32 j = order[z];
+                f32 yj = points[j].posY;
+                f32 vj = points[j].forwardVel;
+                dominated = yj >= yi && vj >= vi && (yj > yi || vj > vi || j < i);
+            }
+            errors += seen[i] != !dominated;
+            frontierSize += !dominated;
+        }
+    }
+    errors += f.numPoints != frontierSize;
+
+    printf("pareto_frontier %s (%d points, %d on the frontier)\n", errors == 0 ? "ok" : "FAILED", NUM_POINTS,
+        f.numPoints);
+    pareto_free(&f);
+    return errors;
+}
+
+// A small beam search from the reference state has to survive and climb higher
+// than the climb/dive controller, and replaying its inputs with act_flying has
+// to reach the max y it reported
+static s32 check_beam_search(void) {
+    struct BeamOptions options = { .width = 64, .frames = 2000, .score = BEAM_SCORE_MAX_Y, .numThreads = 3,
+        .transpositionBytes = 1 << 20, .prune = TRUE };
+    struct RunStop stop = { options.frames, 0, RUN_TARGET_Y, 0 };
+    struct MarioState start, m;
+    struct Controller c;
+    struct TasInputs tasInputs;
+    struct RunResult result, controller;
+
+    start.controller = &c;
+    clear_mario_state(&start);
+    start.pos[1] = -1551.726807f;
+    start.forwardVel = 99.901505f;
+    start.faceAngle[0] = -0x2AAA;
+
+    m = start;
+    run_until(&m, &gRunParamsDefault, &stop, NULL, FALSE, &controller);
+
+    tas_inputs_init(&tasInputs);
+    beam_search(&start, &options, &tasInputs, &result);
+
+    m = start;
+    f32 maxY = m.pos[1];
+    for (s32 i = 0; i < tasInputs.count; i++) {
+        adjust_analog_stick(m.controller, 0, tasInputs.inputs[i].stickY);
+        act_flying(&m, TRUE);
+        maxY = max(maxY, m.pos[1]);
+    }
+
+    s32 ok = !result.died && tasInputs.count == options.frames && memcmp(&maxY, &result.maxY, sizeof(f32)) == 0
+        && result.maxY > controller.maxY
+        && (controller.framesToTarget < 0
+            || (result.framesToTarget >= 0 && result.framesToTarget <= controller.framesToTarget));
+    if (!ok) {
+        printf("beam_search: %d inputs reach max y %f, search reported %f%s, controller reached %f\n",
+            tasInputs.count, maxY, result.maxY, result.died ? " and died" : "", controller.maxY);
+    }
+    printf("beam_search %s (max y %f, controller %f)\n", ok ? "ok" : "FAILED", result.maxY, controller.maxY);
+
+    tas_inputs_free(&tasInputs);
+    return !ok;
+}
+
+// A small tree search has to at least match the climb/dive controller it rolls
+// out with, and its inputs have to reach the max y it reported
+static s32 check_mcts(void) {
+    struct MctsOptions options = { .frames = 120, .iterations = 16, .score = MCTS_SCORE_MAX_Y,
+        .exploration = 0.5f, .numThreads = 3, .memoryBytes = 1 << 20 };
+    struct MarioState start, m;
+    struct Controller c;
+    struct TasInputs tasInputs;
+    struct RunResult result;
+    struct RunPolicy policy;
+
+    start.controller = &c;
+    clear_mario_state(&start);
+    start.pos[1] = -1551.726807f;
+    start.forwardVel = 99.901505f;
+    start.faceAngle[0] = -0x2AAA;
+
+    m = start;
+    f32 policyMaxY = m.pos[1];
+    run_policy_init(&policy, &m, &gRunParamsDefault);
+    for (s32 i = 0; i < options.frames; i++) {
+        adjust_analog_stick(m.controller, 0, run_policy_stick(&policy, &m, NULL));
+        act_flying(&m, TRUE);
+        run_policy_update(&policy, &m);
+        policyMaxY = max(policyMaxY, m.pos[1]);
+    }
+
+    tas_inputs_init(&tasInputs);
+    mcts_search(&start, &options, &tasInputs, &result);
+
+    m = start;
+    f32 maxY = m.pos[1];
+    for (s32 i = 0; i < tasInputs.count; i++) {
+        adjust_analog_stick(m.controller, 0, tasInputs.inputs[i].stickY);
+        act_flying(&m, TRUE);
+        maxY = max(maxY, m.pos[1]);
+    }
+
+    s32 ok = tasInputs.count <= options.frames && memcmp(&maxY, &result.maxY, sizeof(f32)) == 0
+        && result.maxY >= policyMaxY;
+    if (!ok) {
+        printf("mcts: %d inputs reach max y %f, search reported %f, controller reached %f\n", tasInputs.count, maxY,
+            result.maxY, policyMaxY);
+    }
+    printf("mcts %s (max y %f, controller %f)\n", ok ? "ok" : "FAILED", result.maxY, policyMaxY);
+
+    tas_inputs_free(&tasInputs);
+    return !ok;
+}
+
+// CMA-ES has to find the minimum of the Rosenbrock function in as many
+// dimensions as the run() controller has constants
+static s32 check_cmaes(void) {
+    enum { N = 7, MAX_GENERATIONS = 3000 };
+    struct Cmaes c;
+    f64 start[N] = { 0 };
+    f64 costs[64];
+    f64 best = INFINITY;
+    s32 generation;
+
+    cmaes_init(&c, N, 0, start, 0.5, 1);
+    for (generation = 0; generation < MAX_GENERATIONS && best > 1e-10; generation++) {
+        cmaes_sample(&c);
+        for (s32 k = 0; k < c.lambda; k++) {
+            const f64 *x = &c.samples[k * N];
+            costs[k] = 0.0;
+            for (s32 i = 0; i < N - 1; i++) {
+                costs[k] += 100.0 * (x[i + 1] - x[i] * x[i]) * (x[i + 1] - x[i] * x[i]) + (1.0 - x[i]) * (1.0 - x[i]);
+            }
+            best = min(best, costs[k]);
+        }
+        cmaes_update(&c, costs);
+    }
+
+    s32 ok = best <= 1e-10;
+    printf("cmaes %s (rosenbrock %d-d: %g after %d generations)\n", ok ? "ok" : "FAILED", N, best, generation);
+    cmaes_free(&c);
+    return !ok;
+}
+
+// Stopping early has to give the same frames to target and death as flying
+// the whole budget, on the frame the answer is settled
+static s32 check_run_stop(void) {
+    const struct SweepState states[] = {
+        { -500.0f, 100.0f, -0x2AAA, 0 },
+        { 1000.0f, 120.0f, -0x2AAA, 0 },
+        { -2000.0f, 100.0f, -0x2AAA, 0 },
+        { 2000.0f, 30.0f, 0x1000, -0x100 },
+    };
+    const struct RunStop full = { 6000, 0, RUN_TARGET_Y, 0 };
+    const struct RunStop early = { 6000, RUN_STOP_TARGET_Y | RUN_STOP_DEATH, RUN_TARGET_Y, 0 };
+    const struct RunStop speed = { 6000, RUN_STOP_TARGET_SPEED, RUN_TARGET_Y, 140.0f };
+    struct MarioState m;
+    struct Controller c;
+    s32 ok = TRUE;
+
+    for (u32 i = 0; i < sizeof(states) / sizeof(states[0]); i++) {
+        struct RunResult a, b, v;
+        struct MarioState start;
+        start.controller = &c;
+        clear_mario_state(&start);
+        start.pos[1] = states[i].posY;
+        start.forwardVel = states[i].forwardVel;
+        start.faceAngle[0] = states[i].pitch;
+        start.angleVel[0] = states[i].pitchVel;
+
+        m = start;
+        ok &= run_until(&m, &gRunParamsDefault, &full, NULL, FALSE, &a) == RUN_STOPPED_FRAMES;
+        m = start;
+        s32 reason = run_until(&m, &gRunParamsDefault, &early, NULL, FALSE, &b);
+        m = start;
+        run_until(&m, &gRunParamsDefault, &speed, NULL, FALSE, &v);
+
+        if (reason == RUN_STOPPED_DEATH) {
+            ok &= a.died && b.died;
+            ok &= a.framesToTarget < 0 || a.framesToTarget > b.frames;
+        } else if (reason == RUN_STOPPED_TARGET_Y) {
+            ok &= b.framesToTarget == a.framesToTarget && b.frames == a.framesToTarget && !b.died;
+        } else {
+            ok &= a.framesToTarget < 0 && !a.died && b.frames == full.maxFrames;
+        }
+        ok &= v.frames == full.maxFrames || (v.frames < full.maxFrames && m.forwardVel >= 140.0f);
+    }
+
+    printf("run stop %s\n", ok ? "ok" : "FAILED");
+    return !ok;
+}
+
+// flight_step has to follow adjust_analog_stick and act_flying bit for bit, and
+// refuse bad sticks without touching its output
+static s32 check_flight_step(void) {
+    enum { NUM_STATES = 1000, NUM_FRAMES = 200 };
+    struct MarioState m;
+    struct Controller c;
+    s32 ok = TRUE;
+
+    m.controller = &c;
+    for (s32 i = 0; ok && i < NUM_STATES; i++) {
+        struct FlightState s;
+        randomize_mario_state(&m);
+        flight_state_from_mario(&s, &m);
+        s32 downTilt = i % 2;
+
+        for (s32 frame = 0; ok && frame < NUM_FRAMES; frame++) {
+            s16 rawStickX = (s32)(check_random() & 0xFF) - 128;
+            s16 rawStickY = (s32)(check_random() & 0xFF) - 128;
+            adjust_analog_stick(m.controller, rawStickX, rawStickY);
+            act_flying(&m, downTilt);
+
+            // In place, like a caller stepping an array of states
+            ok &= flight_step(&s, rawStickX, rawStickY, downTilt, &s) == FLIGHT_OK;
+
+            struct FlightState expected;
+            flight_state_from_mario(&expected, &m);
+            ok &= memcmp(&s, &expected, sizeof(s)) == 0;
+        }
+    }
+
+    struct FlightState before, after;
+    flight_state_from_mario(&before, &m);
+    after = before;
+    ok &= flight_step(&before, 128, 0, TRUE, &after) == FLIGHT_BAD_STICK;
+    ok &= flight_step(&before, 0, -129, TRUE, &after) == FLIGHT_BAD_STICK;
+    ok &= memcmp(&before, &after, sizeof(before)) == 0;
+
+    printf("flight step %s\n", ok ? "ok" : "FAILED");
+    return !ok;
+}
+
+// A CMA-ES saved mid-search and loaded into a fresh one has to go on sampling
+// exactly the same populations
+static s32 check_checkpoint(void) {
+    enum { N = 7 };
+    char path[256];
+    struct Cmaes a, b;
+    f64 start[N] = { 0 };
+    f64 costs[64];
+    s32 ok = TRUE;
+
+    make_temp_path(path, sizeof(path));
+    cmaes_init(&a, N, 0, start, 0.5, 3);
+    for (s32 g = 0; g < 20; g++) {
+        cmaes_sample(&a);
+        for (s32 k = 0; k < a.lambda; k++) {
+            costs[k] = 0.0;
+            for (s32 i = 0; i < N; i++) {
+                costs[k] += (i + 1) * a.samples[k * N + i] * a.samples[k * N + i];
+            }
+        }
+        cmaes_update(&a, costs);
+    }
+
+    struct CheckpointWriter w;
+    checkpoint_begin(&w, path, CHECKPOINT_TUNE, 1234);
+    cmaes_save(&a, &w);
+    checkpoint_end(&w);
+
+    struct CheckpointReader r;
+    cmaes_init(&b, N, 0, start, 0.5, 4);
+    ok &= checkpoint_open(&r, path, CHECKPOINT_TUNE, 1234);
+    cmaes_load(&b, &r);
+    checkpoint_close(&r);
+    remove(path);
+
+    for (s32 g = 0; ok && g < 5; g++) {
+        cmaes_sample(&a);
+        cmaes_sample(&b);
+        ok &= memcmp(a.samples, b.samples, a.lambda * N * sizeof(f64)) == 0;
+        for (s32 k = 0; k < a.lambda; k++) {
+            costs[k] = a.samples[k * N];
+        }
+        cmaes_update(&a, costs);
+        cmaes_update(&b, costs);
+    }
+    ok &= !checkpoint_open(&r, path, CHECKPOINT_TUNE, 1234);
+
+    printf("checkpoint %s\n", ok ? "ok" : "FAILED");
+    cmaes_free(&a);
+    cmaes_free(&b);
+    return !ok;
+}
+
+// Runs a small beam search from the reference state, with a checkpoint if path
+// isn't NULL
+static void checkpointed_beam_search(const char *path, struct TasInputs *tasInputs, struct RunResult *result) {
+    struct BeamOptions options = { .width = 32, .frames = 200, .score = BEAM_SCORE_MAX_Y, .numThreads = 2,
+        .transpositionBytes = 1 << 20, .prune = TRUE, .checkpoint = { path, 0.0 } };
+    struct MarioState m;
+    struct Controller c;
+
+    m.controller = &c;
+    clear_mario_state(&m);
+    m.pos[1] = -1551.726807f;
+    m.forwardVel = 99.901505f;
+    m.faceAngle[0] = -0x2AAA;
+
+    tas_inputs_init(tasInputs);
+    beam_search(&m, &options, tasInputs, result);
+}
+
+static s32 same_tas_inputs(const struct TasInputs *a, const struct TasInputs *b) {
+    return a->count == b->count && memcmp(a->inputs, b->inputs, a->count * sizeof(struct TasInput)) == 0;
+}
+
+// A beam search saving before every frame and a sweep saving after every chunk
+// have to resume from their last save and end exactly like runs without one
+static s32 check_checkpoint_resume(void) {
+    const char *spec = "-1551.726807:-551.726807:5 99.901505 -10922 0\n";
+    char path[256];
+    struct TasInputs plainInputs, savedInputs, resumedInputs;
+    struct RunResult plain, saved, resumed;
+    struct CheckpointOptions checkpoint = { path, 0.0 };
+    struct Sweep s;
+    s32 ok = TRUE;
+
+    // Only the unique name is wanted, since an empty file isn't a checkpoint
+    make_temp_path(path, sizeof(path));
+    remove(path);
+
+    checkpointed_beam_search(NULL, &plainInputs, &plain);
+    checkpointed_beam_search(path, &savedInputs, &saved);
+    checkpointed_beam_search(path, &resumedInputs, &resumed);
+    remove(path);
+    ok &= same_tas_inputs(&plainInputs, &savedInputs) && same_tas_inputs(&plainInputs, &resumedInputs);
+    ok &= memcmp(&plain, &saved, sizeof(plain)) == 0 && memcmp(&plain, &resumed, sizeof(plain)) == 0;
+    tas_inputs_free(&plainInputs);
+    tas_inputs_free(&savedInputs);
+    tas_inputs_free(&resumedInputs);
+
+    sweep_init(&s);
+    FILE *f = fmemopen((void *) spec, strlen(spec), "r");
+    ok &= f != NULL && sweep_read_spec(&s, f, "check spec");
+    if (f != NULL) {
+        fclose(f);
+    }
+    s.stop.maxFrames = 300;
+
+    struct CheckpointOptions none = { NULL, 0.0 };
+    sweep_run(&s, 2, &none);
+    struct SweepResult *results = malloc(s.count * sizeof(struct SweepResult));
+    memcpy(results, s.results, s.count * sizeof(struct SweepResult));
+    for (s32 run = 0; ok && run < 2; run++) {
+        sweep_run(&s, 2, &checkpoint);
+        ok &= memcmp(results, s.results, s.count * sizeof(struct SweepResult)) == 0;
+    }
+    remove(path);
+
+    printf("checkpoint resume %s (beam to max y %f, %d sweep states)\n", ok ? "ok" : "FAILED", plain.maxY, s.count);
+    free(results);
+    sweep_free(&s);
+    return !ok;
+}
+
+static u32 get_u32(const u8 *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (u32) p[3] << 24;
+}
+
+// A short movie has to have the Mupen64 version 3 header fields and the inputs
+// at their offsets, little endian
+static s32 check_m64(void) {
+    const struct TasInput inputs[] = { { 0x1234, -5, 100 }, { 0, 0, -128 }, { 0x8001, 127, 1 } };
+    enum { COUNT = sizeof(inputs) / sizeof(inputs[0]), SIZE = 0x400 + 4 * COUNT };
+    struct TasInputs t;
+    char path[256];
+    u8 data[SIZE + 1];
+    s32 ok = TRUE;
+
+    tas_inputs_init(&t);
+    for (s32 i = 0; i < COUNT; i++) {
+        tas_inputs_push(&t, inputs[i].buttons, inputs[i].stickX, inputs[i].stickY);
+    }
+    make_temp_path(path, sizeof(path));
+    ok &= tas_inputs_write_m64(&t, path, &gM64DefaultOptions);
+
+    FILE *f = fopen(path, "rb");
+    size_t size = f != NULL ? fread(data, 1, sizeof(data), f) : 0;
+    if (f != NULL) {
+        fclose(f);
+    }
+    remove(path);
+
+    ok &= size == SIZE;
+    if (ok) {
+        ok &= memcmp(data, "M64\x1A", 4) == 0;
+        ok &= get_u32(data + 0x004) == 3;
+        // Frames are VIs, two per input poll
+        ok &= get_u32(data + 0x00C) == 2 * COUNT;
+        ok &= get_u32(data + 0x018) == COUNT;
+        ok &= data[0x015] == 1;
+        // Controller 1 present
+        ok &= get_u32(data + 0x020) == 1;
+        for (s32 i = 0; i < COUNT; i++) {
+            const u8 *sample = data + 0x400 + 4 * i;
+            ok &= (sample[0] | sample[1] << 8) == inputs[i].buttons;
+            ok &= (s8) sample[2] == inputs[i].stickX;
+            ok &= (s8) sample[3] == inputs[i].stickY;
+        }
+    }
+
+    printf("m64 %s (%d inputs, %zu bytes)\n", ok ? "ok" : "FAILED", COUNT, size);
+    tas_inputs_free(&t);
+    return !ok;
+}
+
+// A small table has to give back the simulated cycles at its grid points, and
+// stay between them in between
+static s32 check_cycle_table(void) {
+    const struct CycleAxis axes[CYCLE_AXIS_COUNT] = {
+        { 134.0f, 4.0f, 2 },
+        { -0x2AAA, 1, 1 },
+        { -0xC0, 0x20, 2 },
+        { 6000, 500, 2 },
+    };
+    struct CycleTable t;
+    struct CycleOutcome exact, looked;
+    s32 ok = TRUE;
+
+    cycle_table_init(&t, axes, &gRunParamsDefault);
+    cycle_table_build(&t, 1);
+
+    for (s32 i = 0; i < t.count; i++) {
+        f32 speed = axes[CYCLE_AXIS_SPEED].first + (i >> 2 & 1) * axes[CYCLE_AXIS_SPEED].step;
+        s16 pitchVel = axes[CYCLE_AXIS_PITCH_VEL].first + (i >> 1 & 1) * axes[CYCLE_AXIS_PITCH_VEL].step;
+        f32 depth = axes[CYCLE_AXIS_DEPTH].first + (i & 1) * axes[CYCLE_AXIS_DEPTH].step;
+
+        simulate_cycle(&gRunParamsDefault, speed, -0x2AAA, pitchVel, depth, &exact);
+        ok &= cycle_table_lookup(&t, speed, -0x2AAA, pitchVel, depth, &looked);
+        ok &= memcmp(&exact, &t.outcomes[i], sizeof(exact)) == 0;
+        ok &= memcmp(&exact, &looked, sizeof(exact)) == 0;
+    }
+
+    f32 lo = INFINITY, hi = -INFINITY;
+    for (s32 i = 0; i < t.count; i++) {
+        lo = min(lo, t.outcomes[i].peakRise);
+        hi = max(hi, t.outcomes[i].peakRise);
+    }
+    ok &= cycle_table_lookup(&t, 136.0f, -0x2AAA, -0xB0, 6250, &looked);
+    ok &= looked.peakRise >= lo && looked.peakRise <= hi;
+    ok &= !cycle_table_lookup(&t, 150.0f, -0x2AAA, -0xB0, 6250, &looked);
+
+    printf("cycle table %s (%d cycles)\n", ok ? "ok" : "FAILED", t.count);
+    cycle_table_free(&t);
+    return !ok;
+}
+
+// Best max y a small beam search finds from a state, or -INFINITY if it dies
+static f32 searched_max_y(const struct MarioState *m, s32 frames) {
+    struct BeamOptions options = { .width = 32, .frames = frames, .score = BEAM_SCORE_MAX_Y, .numThreads = 1,
+        .transpositionBytes = 1 << 20, .prune = TRUE };
+    struct RunResult result;
+
+    beam_search(m, &options, NULL, &result);
+    return result.died ? -INFINITY : result.maxY;
+}
+
+s32 check_dominance(void) {
+    enum { NUM_PAIRS = 400, NUM_FRAMES = 600 };
+    struct MarioState a, b;
+    struct Controller c;
+    s32 violations = 0;
+    f32 worst = 0.0f;
+
+    a.controller = &c;
+    b.controller = &c;
+    sCheckSeed = 8;
+
+    for (s32 i = 0; i < NUM_PAIRS; i++) {
+        // b is dominated by a: same angles, no more height and no more speed
+        randomize_mario_state(&b);
+        b.faceAngle[1] = 0;
+        b.angleVel[1] = 0;
+        a = b;
+        a.pos[1] += (f32)(check_random() % 1000) / 10.0f;
+        a.forwardVel += (f32)(check_random() % 500) / 100.0f;
+
+        f32 maxYA = searched_max_y(&a, NUM_FRAMES);
+        f32 maxYB = searched_max_y(&b, NUM_FRAMES);
+        if (maxYA < maxYB) {
+            violations += 1;
+            if (maxYA == -INFINITY || maxYB - maxYA > worst) {
+                worst = maxYA == -INFINITY ? INFINITY : maxYB - maxYA;
+            }
+        }
+    }
+
+    // The beam search isn't exact either, so allow a few misses
+    s32 ok = violations * 20 <= NUM_PAIRS;
+    printf("dominance %s: held in %d of %d pairs over %d frames (worst shortfall %f)\n", ok ? "ok" : "FAILED",
+        NUM_PAIRS - violations, NUM_PAIRS, NUM_FRAMES, worst);
+    return !ok;
+}
+
+s32 run_checks(void) {
+    s32 failures = 0;
+    failures += check_math_tables();
+    failures += check_pitch_drag();
+    failures += check_flight_batch_layout();
+    failures += check_flight_batch();
+    failures += check_pitch_vel_closed_forms() != 0;
+    failures += check_pitch_vel_for_pitch() != 0;
+    failures += check_approach_pitch_vel_raw_stick_y() != 0;
+    failures += check_distinct_pitch_vel_inputs() != 0;
+    failures += check_prune_bounds() != 0;
+    failures += check_transposition_table() != 0;
+    failures += check_pareto_frontier() != 0;
+    failures += check_beam_search();
+    failures += check_mcts();
+    failures += check_cmaes();
+    failures += check_cycle_table();
+    failures += check_checkpoint();
+    failures += check_checkpoint_resume();
+    failures += check_m64();
+    failures += check_run_stop();
+    failures += check_flight_step();
+    failures += check_work_pool();
+    return failures;
+}
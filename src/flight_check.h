@@ -0,0 +1,21 @@
+#ifndef FLIGHT_CHECK_H_
+#define FLIGHT_CHECK_H_
+
+#include "math_util.h"
+
+
+/**
+ * Checks every optimized path (batch kernels, closed forms, lookup tables)
+ * against its reference implementation. Returns the number of failures.
+ */
+s32 run_checks(void);
+
+/**
+ * Measures how often a state with at least the height and speed of another (and
+ * the same angles) does at least as well, comparing the max y a small beam search
+ * finds from each. This is the assumption behind pareto.h; slow, so opt in with
+ * flight check --dominance. Returns nonzero if it fails in more than 5% of pairs.
+ */
+s32 check_dominance(void);
+
+#endif
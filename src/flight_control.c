@@ -0,0 +1,534 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_control.h"
+#include "flight_profile.h"
+
+
+s32 pitch_offset_for_move_pitch(struct MarioState *m, s16 movePitch) {
+    s16 pitch = m->faceAngle[0];
+    if (m->forwardVel > 16.0f)
+        pitch += (m->forwardVel - 32.0f) * 6.0f;
+    else if (m->forwardVel > 4.0f)
+        pitch += (m->forwardVel - 32.0f) * 10.0f;
+    else
+        pitch -= 0x400;
+
+    return movePitch - pitch;
+}
+
+static s32 pitch_vel_for_pitch_offset_pos(s32 offset) {
+    f32 n = (-1.0f + sqrtf(1.0f + (8.0f * offset) / 0x40)) / 2.0f;
+    return (s32)(n * 0x40);
+}
+
+s32 pitch_vel_for_pitch_offset(s32 offset) {
+    if (offset >= 0) {
+        return pitch_vel_for_pitch_offset_pos(offset);
+    } else {
+        return -pitch_vel_for_pitch_offset_pos(-offset);
+    }
+}
+
+// Reference implementation of min_pitch_vel_disp, also used where the closed form
+// can't be shown to round the same way
+s32 min_pitch_vel_disp_loop(struct MarioState *m, s32 pitchVel) {
+    f32 speed = m->forwardVel;
+    s32 disp = 0;
+    s32 iterations = 0;
+
+    while (pitchVel != 0) {
+        iterations++;
+
+        if (m->forwardVel > 16.0f)
+            disp += (speed - 32.0f) * 6.0f;
+        else if (m->forwardVel > 4.0f)
+            disp += (speed - 32.0f) * 10.0f;
+        else
+            disp -= 0x400;
+
+        disp += pitchVel;
+
+        disp -= 0x200;
+
+        pitchVel = approach_s32(pitchVel, 0, 0x40, 0x40);
+    }
+
+    PROFILE_COUNT(PROFILE_DISP_FLOAT_ITERATIONS, iterations);
+    return disp;
+}
+
+/**
+ * Exact replacement for min_pitch_vel_disp_loop.
+ *
+ * The loop runs n = ceil(|pitchVel| / 0x40) steps, and the pitch vels it adds
+ * form an arithmetic series. Each step also adds the jerk J and -0x200, but
+ * `disp += J` adds a float and truncates toward zero. As long as J is far enough
+ * from an integer that rounding the float sum can't land on one, a non-integer J
+ * adds floor(J) while disp + J is non-negative and floor(J) + 1 while it is
+ * negative. So the result is n * (floor(J) - 0x200) + sum(pitchVels) plus the
+ * number of negative steps, which is 0 or n in the common cases and otherwise
+ * counted with an integer-only pass.
+ */
+s32 min_pitch_vel_disp(struct MarioState *m, s32 pitchVel) {
+    PROFILE_COUNT(PROFILE_DISP_CALLS, 1);
+
+    if (pitchVel == 0)
+        return 0;
+
+    // Step k adds pitchVel - dir * 0x40 * k
+    s32 dir = pitchVel > 0 ? 1 : -1;
+    s32 steps = (abs(pitchVel) + 0x3F) / 0x40;
+    s32 velSum = steps * pitchVel - dir * 0x20 * steps * (steps - 1);
+
+    f32 jerk;
+    if (m->forwardVel > 16.0f)
+        jerk = (m->forwardVel - 32.0f) * 6.0f;
+    else if (m->forwardVel > 4.0f)
+        jerk = (m->forwardVel - 32.0f) * 10.0f;
+    else {
+        PROFILE_COUNT(PROFILE_DISP_CLOSED_FORM, 1);
+        return steps * (-0x400 - 0x200) + velSum;
+    }
+
+    // Keep every float sum below 0x10000, where the ulp is at most 1/256
+    if (!(abs(jerk) < 0x1000) || steps * (abs(jerk) + 0x201 + abs(pitchVel)) >= 0x10000)
+        return min_pitch_vel_disp_loop(m, pitchVel);
+
+    s32 jerkFloor = (s32) floorf(jerk);
+    f32 frac = jerk - jerkFloor;
+    s32 disp = steps * (jerkFloor - 0x200) + velSum;
+
+    if (frac == 0.0f) {
+        PROFILE_COUNT(PROFILE_DISP_CLOSED_FORM, 1);
+        return disp;
+    }
+    if (frac < 1.0f / 128 || frac > 1.0f - 1.0f / 128)
+        return min_pitch_vel_disp_loop(m, pitchVel);
+
+    if (dir < 0 && jerkFloor < 0) {
+        // Starts negative, and every step adds at most -0x40 - 0x200 + jerk + 1
+        PROFILE_COUNT(PROFILE_DISP_CLOSED_FORM, 1);
+        return disp + steps;
+    }
+
+    if (dir > 0 && jerkFloor >= 0) {
+        // Starts non-negative and the steps shrink, so the last one is the lowest
+        s32 last = steps - 1;
+        if (last * (jerkFloor - 0x200 + pitchVel) - 0x20 * last * (last - 1) + jerkFloor >= 0) {
+            PROFILE_COUNT(PROFILE_DISP_CLOSED_FORM, 1);
+            return disp;
+        }
+    }
+
+    s32 negativeSteps = 0;
+    s32 partial = 0;
+    for (s32 vel = pitchVel; vel != 0; vel = approach_s32(vel, 0, 0x40, 0x40)) {
+        s32 negative = partial + jerkFloor < 0;
+        partial += jerkFloor + negative + vel - 0x200;
+        negativeSteps += negative;
+    }
+    // One step per multiple of 0x40 in pitchVel, rounded up
+    PROFILE_COUNT(PROFILE_DISP_INT_ITERATIONS, steps);
+
+    return disp + negativeSteps;
+}
+
+// Reference implementation of pitch_vel_for_pitch, kept for `flight check`
+f32 pitch_vel_for_pitch_brute(struct MarioState *m, s32 targetPitch) {
+    f32 bestPitchVel = 0;
+    s32 minDist = 100000;
+
+    for (f32 pv = -0x400; pv < 0x400; pv += 1) {
+        f32 disp = min_pitch_vel_disp_loop(m, pv);
+        f32 dist = abs((targetPitch - m->faceAngle[0]) - disp);
+
+        if (dist < minDist) {
+            minDist = dist;
+            bestPitchVel = pv;
+        }
+    }
+
+    return bestPitchVel;
+}
+
+// Smallest pv in [lo, hi] with min_pitch_vel_disp(m, pv) >= value, or hi + 1
+static s32 first_pitch_vel_with_disp(struct MarioState *m, s32 lo, s32 hi, s32 value) {
+    while (lo <= hi) {
+        s32 mid = lo + (hi - lo) / 2;
+        if (min_pitch_vel_disp(m, mid) >= value) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Last pitch vel that takes as many frames to decay to zero as pv does
+static s32 pitch_vel_decay_group_end(s32 pv) {
+    s32 frames = (abs(pv) + 0x3F) / 0x40;
+    if (pv < 0) {
+        return -0x40 * (frames - 1) - 1;
+    } else {
+        return min(0x40 * frames, 0x3FF);
+    }
+}
+
+/**
+ * Returns the same pitch vel as pitch_vel_for_pitch_brute: the smallest of
+ * -0x400..0x3FF whose min_pitch_vel_disp is closest to the target offset.
+ *
+ * Pitch vels that take the same number of frames to decay form groups of 0x40,
+ * and within a group min_pitch_vel_disp is non-decreasing (each step is a
+ * monotone function of the previous step, float rounding and truncation
+ * included). So each group is binary searched for the two displacements that
+ * bracket the target instead of scanning every candidate.
+ */
+f32 pitch_vel_for_pitch(struct MarioState *m, s32 targetPitch) {
+    s32 offset = targetPitch - m->faceAngle[0];
+    s32 bestPitchVel = 0;
+    s32 minDist = 100000;
+
+    for (s32 start = -0x400; start < 0x400; ) {
+        s32 end = pitch_vel_decay_group_end(start);
+
+        // Last displacement below the offset, at the first pv that reaches it
+        s32 above = first_pitch_vel_with_disp(m, start, end, offset);
+        if (above > start) {
+            s32 disp = min_pitch_vel_disp(m, above - 1);
+            s32 dist = offset - disp;
+            if (dist < minDist) {
+                minDist = dist;
+                bestPitchVel = first_pitch_vel_with_disp(m, start, above - 1, disp);
+            }
+        }
+
+        // First displacement at or above the offset
+        if (above <= end) {
+            s32 dist = min_pitch_vel_disp(m, above) - offset;
+            if (dist < minDist) {
+                minDist = dist;
+                bestPitchVel = above;
+            }
+        }
+
+        start = end + 1;
+    }
+
+    return bestPitchVel;
+}
+
+f32 max_possible_min_y(struct MarioState *m) {
+    f32 y = m->pos[1];
+    f32 speed = m->forwardVel;
+    s32 pitch = m->faceAngle[0];
+    s32 pitchVel = m->angleVel[0];
+
+    while (TRUE) {
+        pitchVel += 0x40;
+
+        speed -= pitch_drag(pitch);
+
+        if (speed > 16.0f)
+            pitch += (speed - 32.0f) * 6.0f;
+        else if (speed > 4.0f)
+            pitch += (speed - 32.0f) * 10.0f;
+        else
+            pitch -= 0x400;
+
+        pitch += pitchVel;
+
+        if (pitch >= 0) {
+            break;
+        }
+
+        y += speed * sins(pitch);
+
+        pitch -= 0x200;
+    }
+
+    return y;
+}
+
+s16 constrain_target_pitch_vel(struct MarioState *m, s16 targetPitchVel) {
+    s16 maxv = (s16)(64.0f * (m->forwardVel / 5.0f));
+    s16 minv = (s16)(-64.0f * (m->forwardVel / 5.0f));
+    return min(max(targetPitchVel, minv), maxv);
+}
+
+s16 approach_pitch_vel(s16 pitchVel, s16 targetPitchVel)
+{
+    return approach_angle_vel(pitchVel, targetPitchVel, 0x20);
+}
+
+
+f32 raw_stick_to_stick_y(s16 rawStickX, s16 rawStickY)
+{
+    f32 stickX;
+    f32 stickY;
+
+    if (rawStickX < -128 || rawStickX > 127 || rawStickY < -128 || rawStickY > 127) {
+        printf("Bad raw stick: %d %d\n", rawStickX, rawStickY);
+        exit(1);
+    }
+
+    // reset the controller's x and y floats.
+    stickX = 0;
+    stickY = 0;
+
+    // modulate the rawStickX and rawStickY to be the new float values by adding/subtracting 6.
+    if(rawStickX <= -8)
+        stickX = rawStickX + 6;
+
+    if(rawStickX >=  8)
+        stickX = rawStickX - 6;
+
+    if(rawStickY <= -8)
+        stickY = rawStickY + 6;
+
+    if(rawStickY >=  8)
+        stickY = rawStickY - 6;
+
+    // calculate float magnitude from the center by vector length.
+    f32 stickMag = sqrtf(stickX * stickX + stickY * stickY);
+
+    // magnitude cannot exceed 64.0f: if it does, modify the values appropriately to
+    // flatten the values down to the allowed maximum value.
+    if(stickMag > 64)
+    {
+        stickX  *= 64 / stickMag;
+        stickY  *= 64 / stickMag;
+        stickMag = 64;
+    }
+
+    return stickY;
+}
+
+// Reference implementation of approach_pitch_vel_raw_stick_y, also used for speeds
+// where the table lookup doesn't apply
+s16 approach_pitch_vel_raw_stick_y_scan(struct MarioState *m, f32 targetPitchVel) {
+    s16 bestRawStickY;
+    s32 closestDist = 1000000;
+
+    for (int rawStickY = -128; rawStickY < 128; rawStickY++) {
+        f32 stickY = raw_stick_to_stick_y(0, rawStickY);
+        s16 actualPitchVel = -(s16) (stickY * (m->forwardVel / 5.0f));
+        s32 dist = abs(targetPitchVel - actualPitchVel);
+
+        if (dist < closestDist) {
+            bestRawStickY = rawStickY;
+            closestDist = dist;
+        }
+    }
+
+    // f32 stickY = -(f32)targetPitchVel * 5.0f / m->forwardVel;
+    // stickY = min(max(stickY, -64.0f), 64.0f);
+
+    return bestRawStickY;
+}
+
+// Distinct stickY values for rawStickX = 0 in ascending order, with the smallest
+// raw stick y that produces each one
+static f32 sStickYValues[256];
+static s16 sStickYRawStick[256];
+static s32 sNumStickYValues;
+static pthread_once_t sStickYTableOnce = PTHREAD_ONCE_INIT;
+
+static void init_stick_y_table(void) {
+    for (s32 rawStickY = -128; rawStickY < 128; rawStickY++) {
+        f32 stickY = raw_stick_to_stick_y(0, rawStickY);
+
+        // Insertion sort by stickY, keeping the existing entry (smaller raw) on ties
+        s32 i = sNumStickYValues;
+        while (i > 0 && sStickYValues[i - 1] > stickY) {
+            i -= 1;
+        }
+        if (i > 0 && sStickYValues[i - 1] == stickY) {
+            continue;
+        }
+
+        memmove(&sStickYValues[i + 1], &sStickYValues[i], (sNumStickYValues - i) * sizeof(f32));
+        memmove(&sStickYRawStick[i + 1], &sStickYRawStick[i], (sNumStickYValues - i) * sizeof(s16));
+        sStickYValues[i] = stickY;
+        sStickYRawStick[i] = rawStickY;
+        sNumStickYValues += 1;
+    }
+}
+
+void flight_control_init(void) {
+    pthread_once(&sStickYTableOnce, init_stick_y_table);
+}
+
+s32 stick_y_table(const f32 **stickY, const s16 **rawStickY) {
+    flight_control_init();
+    *stickY = sStickYValues;
+    *rawStickY = sStickYRawStick;
+    return sNumStickYValues;
+}
+
+static s16 stick_y_table_pitch_vel(s32 i, f32 speedScale) {
+    return -(s16) (sStickYValues[i] * speedScale);
+}
+
+/**
+ * Returns the same raw stick y as approach_pitch_vel_raw_stick_y_scan.
+ *
+ * For a non-negative speed the resulting pitch vel is non-increasing in stickY,
+ * so a binary search over the sorted stickY table finds the two pitch vels that
+ * bracket the target. Several stickY values can give the same pitch vel, so the
+ * smallest raw stick among them is picked, matching the scan's tie-breaking.
+ */
+s16 approach_pitch_vel_raw_stick_y(struct MarioState *m, f32 targetPitchVel) {
+    f32 speedScale = m->forwardVel / 5.0f;
+
+    // Outside this range the s16 truncation could wrap and break monotonicity
+    if (!(speedScale >= 0.0f && speedScale < 0x200)) {
+        return approach_pitch_vel_raw_stick_y_scan(m, targetPitchVel);
+    }
+
+    flight_control_init();
+
+    // First entry whose pitch vel is at most the target
+    s32 lo = 0;
+    s32 hi = sNumStickYValues;
+    while (lo < hi) {
+        s32 mid = (lo + hi) / 2;
+        if (stick_y_table_pitch_vel(mid, speedScale) <= targetPitchVel) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    s32 belowDist = 1000000;
+    s32 aboveDist = 1000000;
+    if (lo < sNumStickYValues) {
+        belowDist = abs(targetPitchVel - stick_y_table_pitch_vel(lo, speedScale));
+    }
+    if (lo > 0) {
+        aboveDist = abs(targetPitchVel - stick_y_table_pitch_vel(lo - 1, speedScale));
+    }
+
+    s16 bestRawStickY = 127;
+    if (belowDist <= aboveDist) {
+        s16 pitchVel = stick_y_table_pitch_vel(lo, speedScale);
+        for (s32 i = lo; i < sNumStickYValues && stick_y_table_pitch_vel(i, speedScale) == pitchVel; i++) {
+            bestRawStickY = min(bestRawStickY, sStickYRawStick[i]);
+        }
+    }
+    if (aboveDist <= belowDist) {
+        s16 pitchVel = stick_y_table_pitch_vel(lo - 1, speedScale);
+        for (s32 i = lo - 1; i >= 0 && stick_y_table_pitch_vel(i, speedScale) == pitchVel; i--) {
+            bestRawStickY = min(bestRawStickY, sStickYRawStick[i]);
+        }
+    }
+
+    return bestRawStickY;
+}
+
+s32 distinct_pitch_vel_inputs(struct MarioState *m, struct PitchVelInput *inputs) {
+    const f32 *stickYValues;
+    const s16 *rawStickYValues;
+    s32 numValues = stick_y_table(&stickYValues, &rawStickYValues);
+
+    // Index into inputs of each next pitch vel, offset by 0x40 from the current
+    // one. Further away is only possible if the s16 wraps, which falls back to a
+    // linear search.
+    s16 seen[0x81];
+    memset(seen, 0xFF, sizeof(seen));
+
+    s32 count = 0;
+    for (s32 i = 0; i < numValues; i++) {
+        s16 targetPitchVel = -(s16) (stickYValues[i] * (m->forwardVel / 5.0f));
+        s16 pitchVel = approach_pitch_vel(m->angleVel[0], targetPitchVel);
+        s32 offset = pitchVel - m->angleVel[0] + 0x40;
+
+        s32 j = -1;
+        if (offset >= 0 && offset <= 0x80) {
+            j = seen[offset];
+            if (j < 0) {
+                seen[offset] = count;
+            }
+        } else {
+            for (s32 k = 0; k < count && j < 0; k++) {
+                j = inputs[k].pitchVel == pitchVel ? k : -1;
+            }
+        }
+
+        if (j >= 0) {
+            inputs[j].rawStickY = min(inputs[j].rawStickY, rawStickYValues[i]);
+        } else {
+            inputs[count].rawStickY = rawStickYValues[i];
+            inputs[count].pitchVel = pitchVel;
+            count += 1;
+        }
+    }
+
+    return count;
+}
+
+// static f32 approach_pitch_vel_stick_y(struct MarioState *m, s16 targetPitchVel) {
+//     f32 stickY = -(f32)targetPitchVel * 5.0f / m->forwardVel;
+//     return min(max(stickY, -64.0f), 64.0f);
+// }
+
+// static s16 stick_y_to_raw_stick_y(f32 stickY) {
+//     s16 rawStickY = (s16)((stickY / 64) * 128);
+//     return min(max(rawStickY, -128), 127);
+// }
+
+
+f32 energy(struct MarioState *m) {
+    return flight_energy(m->pos[1], m->forwardVel);
+}
+
+s32 speed_jerk(struct MarioState *m, f32 speed) {
+    if (speed > 16.0f)
+        return (speed - 32.0f) * 6.0f;
+    else if (speed > 4.0f)
+        return (speed - 32.0f) * 10.0f;
+    else
+        return -0x400;
+}
+
+f32 total_speed_jerk(struct MarioState *m, f32 speed) {
+    return speed_jerk(m, speed) - 0x200;
+}
+
+// Reference implementation of halting_pitch, kept for `flight check`
+s32 halting_pitch_loop(struct MarioState *m) {
+    s32 pitch = 0;
+    s32 vel = m->angleVel[0];
+    f32 jerk = total_speed_jerk(m, m->forwardVel);
+
+    while (vel != 0) {
+        vel = approach_s32(vel, 0, 0x40, 0x40);
+        pitch += vel + jerk;
+    }
+
+    return pitch;
+}
+
+// Closed form of halting_pitch_loop. The jerk is an integer here, so the sum is
+// exact: the n - 1 nonzero pitch vels form an arithmetic series.
+s32 halting_pitch(struct MarioState *m) {
+    s32 vel = m->angleVel[0];
+    s32 jerk = total_speed_jerk(m, m->forwardVel);
+    s32 dir = vel > 0 ? 1 : -1;
+    s32 steps = (abs(vel) + 0x3F) / 0x40;
+
+    return steps * jerk + (steps - 1) * vel - dir * 0x20 * steps * (steps - 1);
+}
+
+void target_pitch(struct MarioState *m, s16 targetPitch) {
+    // printf("%d, %d, %d\n", m->faceAngle[0], halting_pitch(m), targetPitch);
+    if (m->faceAngle[0] + halting_pitch(m) < targetPitch) {
+        m->controller->stickY = -64;
+    } else {
+        m->controller->stickY = 64;
+    }
+}
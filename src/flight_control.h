@@ -0,0 +1,59 @@
+#ifndef FLIGHT_CONTROL_H_
+#define FLIGHT_CONTROL_H_
+
+#include "flight_physics.h"
+
+
+// Builds the lookup tables, once. The functions below that need them call it
+// themselves, from any thread.
+void flight_control_init(void);
+
+s32 pitch_offset_for_move_pitch(struct MarioState *m, s16 movePitch);
+s32 pitch_vel_for_pitch_offset(s32 offset);
+
+s32 min_pitch_vel_disp(struct MarioState *m, s32 pitchVel);
+f32 pitch_vel_for_pitch(struct MarioState *m, s32 targetPitch);
+f32 max_possible_min_y(struct MarioState *m);
+
+s16 constrain_target_pitch_vel(struct MarioState *m, s16 targetPitchVel);
+s16 approach_pitch_vel(s16 pitchVel, s16 targetPitchVel);
+f32 raw_stick_to_stick_y(s16 rawStickX, s16 rawStickY);
+s16 approach_pitch_vel_raw_stick_y(struct MarioState *m, f32 targetPitchVel);
+// The distinct stickY values for rawStickX = 0 in ascending order, each with the
+// smallest raw stick y that gives it. Returns the number of values.
+s32 stick_y_table(const f32 **stickY, const s16 **rawStickY);
+
+struct PitchVelInput
+{
+    s16 rawStickY;
+    s16 pitchVel;
+};
+
+/**
+ * With rawStickX = 0 the stick only changes angleVel[0], so every raw stick y
+ * that gives the same angleVel[0] leads to the same next state. Stores each
+ * distinct angleVel[0] the next act_flying can produce, with the smallest raw
+ * stick y giving it, and returns how many there are (at most 256). Searches
+ * only need to expand these.
+ */
+s32 distinct_pitch_vel_inputs(struct MarioState *m, struct PitchVelInput *inputs);
+
+// Speed squared plus height scaled to the same units, which a dive or climb
+// only trades between the two
+static inline f32 flight_energy(f32 posY, f32 forwardVel) {
+    return forwardVel * forwardVel + 4.0f / 3.141592653f * posY;
+}
+
+f32 energy(struct MarioState *m);
+s32 speed_jerk(struct MarioState *m, f32 speed);
+f32 total_speed_jerk(struct MarioState *m, f32 speed);
+s32 halting_pitch(struct MarioState *m);
+void target_pitch(struct MarioState *m, s16 targetPitch);
+
+// Straightforward versions of the functions above, used by `flight check`
+s32 min_pitch_vel_disp_loop(struct MarioState *m, s32 pitchVel);
+f32 pitch_vel_for_pitch_brute(struct MarioState *m, s32 targetPitch);
+s16 approach_pitch_vel_raw_stick_y_scan(struct MarioState *m, f32 targetPitchVel);
+s32 halting_pitch_loop(struct MarioState *m);
+
+#endif
@@ -0,0 +1,250 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_cycle.h"
+#include "flight_control.h"
+#include "work_pool.h"
+
+
+// Gives up on a cycle that hasn't ended after this many frames
+#define CYCLE_MAX_FRAMES 2000
+
+// From the reference state, run() pulls out of its dives at pitch -0x2AAA to
+// -0x2A48, with speed 132 to 200 and pitch vel -156 to -626, and dives 6000 to
+// 14000 below the top of each climb. The axes leave a little room around that.
+const struct CycleAxis gCycleAxesDefault[CYCLE_AXIS_COUNT] = {
+    { 128.0f, 2.0f, 39 },
+    { -0x2AAA, 0x70, 2 },
+    { -0x290, 0x20, 17 },
+    { 4000, 1000, 13 },
+};
+
+void cycle_table_init(struct CycleTable *t, const struct CycleAxis *axes, const struct RunParams *params) {
+    memcpy(t->axes, axes, sizeof(t->axes));
+    t->params = params;
+    t->count = 1;
+    for (s32 i = 0; i < CYCLE_AXIS_COUNT; i++) {
+        t->count *= axes[i].count;
+    }
+
+    t->outcomes = malloc(max(t->count, 1) * sizeof(struct CycleOutcome));
+    if (t->outcomes == NULL) {
+        printf("Failed to allocate %d cycle outcomes\n", t->count);
+        exit(1);
+    }
+}
+
+void cycle_table_free(struct CycleTable *t) {
+    free(t->outcomes);
+    t->outcomes = NULL;
+    t->count = 0;
+}
+
+void simulate_cycle(const struct RunParams *params, f32 speed, s16 pitch, s16 pitchVel, f32 depth,
+                    struct CycleOutcome *out) {
+    struct MarioState m;
+    struct Controller c;
+    struct RunPolicy policy = { .params = params, .phase = 1 };
+
+    m.controller = &c;
+    clear_mario_state(&m);
+    m.forwardVel = speed;
+    m.faceAngle[0] = pitch;
+    m.angleVel[0] = pitchVel;
+
+    f32 peak = 0.0f;
+    f32 low = 0.0f;
+    s32 framesToPeak = 0;
+    s32 frame = 0;
+
+    while (frame < CYCLE_MAX_FRAMES) {
+        adjust_analog_stick(m.controller, 0, run_policy_stick(&policy, &m, NULL));
+        act_flying(&m, TRUE);
+        frame += 1;
+
+        if (m.pos[1] > peak) {
+            peak = m.pos[1];
+            framesToPeak = frame;
+        }
+        low = min(low, m.pos[1]);
+
+        if (policy.phase == 1) {
+            if (m.forwardVel < params->climbMinSpeed) {
+                policy.phase = -1;
+            }
+        } else if (m.pos[1] < peak - depth) {
+            break;
+        }
+    }
+
+    out->peakRise = peak;
+    out->framesToPeak = framesToPeak;
+    out->minRise = low;
+    out->exitRise = m.pos[1];
+    out->exitSpeed = m.forwardVel;
+    out->exitPitch = m.faceAngle[0];
+    out->exitPitchVel = m.angleVel[0];
+    out->frames = frame;
+}
+
+static f32 axis_value(const struct CycleAxis *axis, s32 i) {
+    return axis->first + i * axis->step;
+}
+
+static void build_outcome(void *arg, s32 index, s32 thread) {
+    (void) thread;
+    struct CycleTable *t = arg;
+    s32 i[CYCLE_AXIS_COUNT];
+
+    s32 rest = index;
+    for (s32 a = CYCLE_AXIS_COUNT - 1; a >= 0; a--) {
+        i[a] = rest % t->axes[a].count;
+        rest /= t->axes[a].count;
+    }
+
+    simulate_cycle(t->params,
+        axis_value(&t->axes[CYCLE_AXIS_SPEED], i[CYCLE_AXIS_SPEED]),
+        (s16) lroundf(axis_value(&t->axes[CYCLE_AXIS_PITCH], i[CYCLE_AXIS_PITCH])),
+        (s16) lroundf(axis_value(&t->axes[CYCLE_AXIS_PITCH_VEL], i[CYCLE_AXIS_PITCH_VEL])),
+        axis_value(&t->axes[CYCLE_AXIS_DEPTH], i[CYCLE_AXIS_DEPTH]),
+        &t->outcomes[index]);
+}
+
+void cycle_table_build(struct CycleTable *t, s32 numThreads) {
+    work_pool_run(t->count, numThreads, build_outcome, t);
+}
+
+s32 cycle_table_lookup(const struct CycleTable *t, f32 speed, f32 pitch, f32 pitchVel, f32 depth,
+                       struct CycleOutcome *out) {
+    f32 values[CYCLE_AXIS_COUNT] = { speed, pitch, pitchVel, depth };
+    s32 lo[CYCLE_AXIS_COUNT];
+    s32 hi[CYCLE_AXIS_COUNT];
+    f32 frac[CYCLE_AXIS_COUNT];
+    s32 inRange = TRUE;
+
+    for (s32 a = 0; a < CYCLE_AXIS_COUNT; a++) {
+        const struct CycleAxis *axis = &t->axes[a];
+        f32 u = (values[a] - axis->first) / axis->step;
+        if (u < 0.0f || u > axis->count - 1) {
+            inRange = FALSE;
+            u = min(max(u, 0.0f), (f32)(axis->count - 1));
+        }
+        lo[a] = min((s32) u, max(axis->count - 2, 0));
+        hi[a] = min(lo[a] + 1, axis->count - 1);
+        frac[a] = u - lo[a];
+    }
+
+    f32 peakRise = 0, framesToPeak = 0, minRise = 0, exitRise = 0;
+    f32 exitSpeed = 0, exitPitch = 0, exitPitchVel = 0, frames = 0;
+
+    // Weighted sum over the 16 corners of the surrounding cell
+    for (s32 corner = 0; corner < 1 << CYCLE_AXIS_COUNT; corner++) {
+        s32 index = 0;
+        f32 weight = 1.0f;
+        for (s32 a = 0; a < CYCLE_AXIS_COUNT; a++) {
+            s32 upper = corner >> a & 1;
+            index = index * t->axes[a].count + (upper ? hi[a] : lo[a]);
+            weight *= upper ? frac[a] : 1.0f - frac[a];
+        }
+        if (weight == 0.0f) {
+            continue;
+        }
+
+        const struct CycleOutcome *o = &t->outcomes[index];
+        peakRise += weight * o->peakRise;
+        framesToPeak += weight * o->framesToPeak;
+        minRise += weight * o->minRise;
+        exitRise += weight * o->exitRise;
+        exitSpeed += weight * o->exitSpeed;
+        exitPitch += weight * o->exitPitch;
+        exitPitchVel += weight * o->exitPitchVel;
+        frames += weight * o->frames;
+    }
+
+    out->peakRise = peakRise;
+    out->framesToPeak = lroundf(framesToPeak);
+    out->minRise = minRise;
+    out->exitRise = exitRise;
+    out->exitSpeed = exitSpeed;
+    out->exitPitch = lroundf(exitPitch);
+    out->exitPitchVel = lroundf(exitPitchVel);
+    out->frames = max(lroundf(frames), 1);
+    return inRange;
+}
+
+static void update_target(struct CycleEstimate *e, f32 y, s32 frame) {
+    e->maxY = max(e->maxY, y);
+    if (e->framesToTarget < 0 && y >= RUN_TARGET_Y) {
+        e->framesToTarget = frame;
+    }
+}
+
+void cycle_table_estimate(const struct CycleTable *t, const struct MarioState *m, s32 maxFrames,
+                          struct CycleEstimate *e) {
+    const struct RunParams *params = t->params;
+    struct MarioState s = *m;
+    struct Controller c;
+    struct RunPolicy policy;
+
+    // Same starting values as run()
+    e->maxY = -1000000;
+    e->minY = 1000000;
+    e->framesToTarget = -1;
+    e->frames = 0;
+    e->cycles = 0;
+    e->outOfRange = 0;
+
+    s.controller = &c;
+    run_policy_init(&policy, &s, params);
+
+    // Exactly up to the start of the first full cycle
+    while (e->frames < maxFrames) {
+        adjust_analog_stick(s.controller, 0, run_policy_stick(&policy, &s, NULL));
+        act_flying(&s, TRUE);
+        e->frames += 1;
+
+        e->minY = min(e->minY, s.pos[1]);
+        update_target(e, s.pos[1], e->frames);
+        if (run_policy_update(&policy, &s) && policy.phase > 0) {
+            break;
+        }
+    }
+
+    f32 y = s.pos[1];
+    f32 speed = s.forwardVel;
+    f32 pitch = s.faceAngle[0];
+    f32 pitchVel = s.angleVel[0];
+    f32 maxY = policy.maxY;
+
+    while (e->frames < maxFrames) {
+        struct CycleOutcome o;
+
+        // The top comes before the dive can end, so any depth gives it
+        cycle_table_lookup(t, speed, pitch, pitchVel, t->axes[CYCLE_AXIS_DEPTH].first, &o);
+        f32 peakY = y + o.peakRise;
+        maxY = max(maxY, peakY);
+
+        f32 endY = maxY < params->highThreshold
+            ? policy.startY + max(maxY - policy.startY - params->lowDiveSlack, 0) - params->lowDiveDrop
+            : params->highDiveY;
+        e->outOfRange += !cycle_table_lookup(t, speed, pitch, pitchVel, peakY - endY, &o);
+
+        // The target is passed on the way up, a little before the top
+        if (e->frames + o.framesToPeak <= maxFrames) {
+            update_target(e, peakY, e->frames + o.framesToPeak);
+        }
+        if (e->frames + o.frames > maxFrames) {
+            break;
+        }
+
+        e->minY = min(e->minY, y + o.minRise);
+        y += o.exitRise;
+        speed = o.exitSpeed;
+        pitch = o.exitPitch;
+        pitchVel = o.exitPitchVel;
+        e->frames += o.frames;
+        e->cycles += 1;
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef FLIGHT_CYCLE_H_
+#define FLIGHT_CYCLE_H_
+
+#include "flight_physics.h"
+#include "flight_run.h"
+
+
+// The climb/dive controller repeats one cycle: from the frame a dive turns
+// into a climb, climb until speed runs out, then dive until y is some depth
+// below the top of the climb. Heights only shift the whole cycle, so its
+// outcome depends on the entry speed, pitch and pitch vel and the dive depth.
+// Cycles start at the bottom, where pitch has settled at the dive pitch, since
+// the state at the top depends too much on the exact frame the climb ends.
+
+enum CycleAxisIndex
+{
+    CYCLE_AXIS_SPEED,
+    CYCLE_AXIS_PITCH,
+    CYCLE_AXIS_PITCH_VEL,
+    // How far below the top of the climb the dive ends
+    CYCLE_AXIS_DEPTH,
+    CYCLE_AXIS_COUNT,
+};
+
+// count evenly spaced values starting at first
+struct CycleAxis
+{
+    f32 first;
+    f32 step;
+    s32 count;
+};
+
+// One cycle, with heights relative to the entry y
+struct CycleOutcome
+{
+    // Top of the climb, just after it turns into a dive, and the frames to get there
+    f32 peakRise;
+    s32 framesToPeak;
+    // Lowest point, where Mario is still pulling out of the dive
+    f32 minRise;
+    // State at the next dive to climb switch
+    f32 exitRise;
+    f32 exitSpeed;
+    s32 exitPitch;
+    s32 exitPitchVel;
+    s32 frames;
+};
+
+struct CycleTable
+{
+    struct CycleAxis axes[CYCLE_AXIS_COUNT];
+    const struct RunParams *params;
+    // Indexed with the speed axis varying slowest and the depth axis fastest
+    struct CycleOutcome *outcomes;
+    s32 count;
+};
+
+// Axes that cover the cycles run() flies with the default constants
+extern const struct CycleAxis gCycleAxesDefault[CYCLE_AXIS_COUNT];
+
+// params has to outlive the table
+void cycle_table_init(struct CycleTable *t, const struct CycleAxis *axes, const struct RunParams *params);
+void cycle_table_free(struct CycleTable *t);
+
+// Simulates the cycle for every grid point on numThreads threads
+void cycle_table_build(struct CycleTable *t, s32 numThreads);
+
+// Flies one cycle from y = 0 with act_flying
+void simulate_cycle(const struct RunParams *params, f32 speed, s16 pitch, s16 pitchVel, f32 depth,
+                    struct CycleOutcome *out);
+
+/**
+ * Interpolates a cycle's outcome linearly between the surrounding grid points.
+ * Points outside the grid are clamped to it, and FALSE is returned.
+ */
+s32 cycle_table_lookup(const struct CycleTable *t, f32 speed, f32 pitch, f32 pitchVel, f32 depth,
+                       struct CycleOutcome *out);
+
+struct CycleEstimate
+{
+    f32 maxY;
+    f32 minY;
+    s32 framesToTarget;
+    s32 frames;
+    s32 cycles;
+    // Cycles that started outside the table's grid
+    s32 outOfRange;
+};
+
+/**
+ * Estimates run_with_params over maxFrames frames by flying frame by frame up
+ * to the first dive to climb switch, then chaining cycles from the table.
+ * The dive depth of each cycle follows the controller's rules.
+ */
+void cycle_table_estimate(const struct CycleTable *t, const struct MarioState *m, s32 maxFrames,
+                          struct CycleEstimate *e);
+
+#endif
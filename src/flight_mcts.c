@@ -0,0 +1,587 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_mcts.h"
+#include "flight_control.h"
+#include "work_pool.h"
+
+
+// firstChild of a node whose children don't exist yet
+#define MCTS_UNEXPANDED -1
+// Another thread is creating the children
+#define MCTS_EXPANDING -2
+// Never expanded: Mario died or the frame budget is used up
+#define MCTS_LEAF -3
+// Not expanded since the arena was full. Unexpanded again once the tree moves
+// to the other arena and there may be room.
+#define MCTS_FULL -4
+
+const char *gMctsScoreNames[MCTS_SCORE_COUNT] = { "maxy", "target" };
+
+struct MctsNode
+{
+    // State after the input that leads here
+    f32 posY;
+    f32 forwardVel;
+    s16 faceAngle[3];
+    s16 angleVel[2];
+    s8 rawStickY;
+    s16 numChildren;
+    // Frames since the initial state
+    s32 frame;
+    struct RunPolicy policy;
+    // Outcome of the path from the initial state
+    f32 maxY;
+    s32 framesToTarget;
+
+    // Children are numChildren consecutive nodes starting here
+    _Atomic s32 firstChild;
+    _Atomic s32 visits;
+    // Rollouts currently passing through, each counted as a loss until it returns
+    _Atomic s32 virtualLoss;
+    _Atomic f64 rewardSum;
+};
+
+struct MctsArena
+{
+    struct MctsNode *nodes;
+    s32 capacity;
+    _Atomic s32 count;
+};
+
+// Scratch memory for one thread
+struct MctsThread
+{
+    struct Controller controller;
+    s32 *path;
+    s8 *rollout;
+};
+
+struct MctsSearch
+{
+    const struct MctsOptions *options;
+
+    // The tree lives in arenas[current]. Committing an input copies the subtree
+    // of the new root into the other one.
+    struct MctsArena arenas[2];
+    s32 current;
+
+    // Inputs from the initial state to the root
+    s8 *committed;
+    s32 numCommitted;
+
+    // Range of rewards seen so far, for scaling them to [0, 1]
+    _Atomic f64 minReward;
+    _Atomic f64 maxReward;
+
+    pthread_mutex_t bestLock;
+    _Atomic f64 bestReward;
+    s8 *bestInputs;
+    s32 bestLength;
+
+    struct MctsThread *threads;
+};
+
+static void *mcts_alloc(size_t size) {
+    void *p = malloc(max(size, 1));
+    if (p == NULL) {
+        printf("Failed to allocate %zu bytes for the tree search\n", size);
+        exit(1);
+    }
+    return p;
+}
+
+static struct MctsNode *root_node(struct MctsSearch *s) {
+    return &s->arenas[s->current].nodes[0];
+}
+
+static void node_to_mario_state(const struct MctsNode *node, struct MarioState *m) {
+    m->pos[1] = node->posY;
+    m->forwardVel = node->forwardVel;
+    for (s32 i = 0; i < 3; i++) {
+        m->faceAngle[i] = node->faceAngle[i];
+    }
+    for (s32 i = 0; i < 2; i++) {
+        m->angleVel[i] = node->angleVel[i];
+    }
+}
+
+static void init_node(struct MctsSearch *s, struct MctsNode *node, const struct MarioState *m) {
+    node->posY = m->pos[1];
+    node->forwardVel = m->forwardVel;
+    for (s32 i = 0; i < 3; i++) {
+        node->faceAngle[i] = m->faceAngle[i];
+    }
+    for (s32 i = 0; i < 2; i++) {
+        node->angleVel[i] = m->angleVel[i];
+    }
+    node->numChildren = 0;
+
+    s32 done = node->posY < RUN_DEATH_Y || node->frame >= s->options->frames
+        || (s->options->score == MCTS_SCORE_TARGET && node->framesToTarget >= 0);
+    atomic_init(&node->firstChild, done ? MCTS_LEAF : MCTS_UNEXPANDED);
+    atomic_init(&node->visits, 0);
+    atomic_init(&node->virtualLoss, 0);
+    atomic_init(&node->rewardSum, 0.0);
+}
+
+static f64 reward(struct MctsSearch *s, f32 maxY, s32 framesToTarget, s32 died) {
+    if (died) {
+        return RUN_DEATH_Y;
+    }
+    if (s->options->score == MCTS_SCORE_TARGET && framesToTarget >= 0) {
+        return RUN_TARGET_Y + (s->options->frames - framesToTarget);
+    }
+    return maxY;
+}
+
+static void atomic_add_f64(_Atomic f64 *x, f64 value) {
+    f64 old = atomic_load_explicit(x, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(x, &old, old + value, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void atomic_min_f64(_Atomic f64 *x, f64 value) {
+    f64 old = atomic_load_explicit(x, memory_order_relaxed);
+    while (value < old && !atomic_compare_exchange_weak_explicit(x, &old, value,
+            memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void atomic_max_f64(_Atomic f64 *x, f64 value) {
+    f64 old = atomic_load_explicit(x, memory_order_relaxed);
+    while (value > old && !atomic_compare_exchange_weak_explicit(x, &old, value,
+            memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+// Reserves count nodes, or returns -1 if the arena is full
+static s32 arena_reserve(struct MctsArena *a, s32 count) {
+    s32 first = atomic_load_explicit(&a->count, memory_order_relaxed);
+    while (first + count <= a->capacity) {
+        if (atomic_compare_exchange_weak_explicit(&a->count, &first, first + count,
+                memory_order_relaxed, memory_order_relaxed)) {
+            return first;
+        }
+    }
+    return -1;
+}
+
+// Creates the children of a leaf, unless another thread got there first.
+// Returns whether the node now has children.
+static s32 expand(struct MctsSearch *s, struct MctsNode *node, struct MctsThread *t) {
+    s32 expected = MCTS_UNEXPANDED;
+    if (!atomic_compare_exchange_strong_explicit(&node->firstChild, &expected, MCTS_EXPANDING,
+            memory_order_acquire, memory_order_relaxed)) {
+        return expected >= 0;
+    }
+
+    struct PitchVelInput inputs[256];
+    struct MarioState m;
+    m.controller = &t->controller;
+    node_to_mario_state(node, &m);
+    s32 count = distinct_pitch_vel_inputs(&m, inputs);
+
+    struct MctsArena *a = &s->arenas[s->current];
+    s32 first = arena_reserve(a, count);
+    if (first < 0) {
+        atomic_store_explicit(&node->firstChild, MCTS_FULL, memory_order_release);
+        return FALSE;
+    }
+
+    for (s32 i = 0; i < count; i++) {
+        struct MctsNode *child = &a->nodes[first + i];
+        struct MarioState next = m;
+
+        adjust_analog_stick(next.controller, 0, inputs[i].rawStickY);
+        act_flying(&next, TRUE);
+
+        child->rawStickY = inputs[i].rawStickY;
+        child->frame = node->frame + 1;
+        child->policy = node->policy;
+        run_policy_update(&child->policy, &next);
+        child->maxY = max(node->maxY, next.pos[1]);
+        child->framesToTarget = node->framesToTarget >= 0 ? node->framesToTarget
+            : child->maxY >= RUN_TARGET_Y ? child->frame : -1;
+        init_node(s, child, &next);
+    }
+
+    node->numChildren = count;
+    atomic_store_explicit(&node->firstChild, first, memory_order_release);
+    return TRUE;
+}
+
+// UCT, with unvisited children first and virtual losses scored as the worst reward
+static s32 select_child(struct MctsSearch *s, struct MctsNode *node, s32 firstChild) {
+    struct MctsNode *nodes = s->arenas[s->current].nodes;
+    f64 lo = atomic_load_explicit(&s->minReward, memory_order_relaxed);
+    f64 hi = atomic_load_explicit(&s->maxReward, memory_order_relaxed);
+    f64 range = hi > lo ? hi - lo : 1.0;
+    s32 parentVisits = atomic_load_explicit(&node->visits, memory_order_relaxed)
+        + atomic_load_explicit(&node->virtualLoss, memory_order_relaxed);
+    f64 logVisits = log(max(parentVisits, 1));
+
+    s32 best = firstChild;
+    f64 bestScore = -INFINITY;
+    for (s32 i = firstChild; i < firstChild + node->numChildren; i++) {
+        struct MctsNode *child = &nodes[i];
+        s32 virtualLoss = atomic_load_explicit(&child->virtualLoss, memory_order_relaxed);
+        s32 visits = atomic_load_explicit(&child->visits, memory_order_relaxed) + virtualLoss;
+        if (visits == 0) {
+            return i;
+        }
+
+        f64 mean = (atomic_load_explicit(&child->rewardSum, memory_order_relaxed) + virtualLoss * lo) / visits;
+        f64 score = (mean - lo) / range + s->options->exploration * sqrt(logVisits / visits);
+        if (score > bestScore) {
+            best = i;
+            bestScore = score;
+        }
+    }
+    return best;
+}
+
+// Flies the climb/dive controller from a node to the end of the frame budget
+static f64 rollout(struct MctsSearch *s, const struct MctsNode *node, struct MctsThread *t, s32 *length) {
+    struct MarioState m;
+    struct RunPolicy policy = node->policy;
+    f32 maxY = node->maxY;
+    s32 framesToTarget = node->framesToTarget;
+    s32 died = node->posY < RUN_DEATH_Y;
+    s32 n = 0;
+
+    m.controller = &t->controller;
+    node_to_mario_state(node, &m);
+
+    for (s32 frame = node->frame; frame < s->options->frames && !died; frame++) {
+        if (s->options->score == MCTS_SCORE_TARGET && framesToTarget >= 0) {
+            break;
+        }
+
+        s16 rawStickY = run_policy_stick(&policy, &m, NULL);
+        adjust_analog_stick(m.controller, 0, rawStickY);
+        act_flying(&m, TRUE);
+        run_policy_update(&policy, &m);
+        t->rollout[n++] = rawStickY;
+
+        maxY = max(maxY, m.pos[1]);
+        if (framesToTarget < 0 && maxY >= RUN_TARGET_Y) {
+            framesToTarget = frame + 1;
+        }
+        died = m.pos[1] < RUN_DEATH_Y;
+    }
+
+    *length = n;
+    return reward(s, maxY, framesToTarget, died);
+}
+
+// Keeps the inputs of the best rollout: committed, then tree path, then rollout
+static void record_best(struct MctsSearch *s, struct MctsThread *t, s32 depth, s32 length, f64 value) {
+    struct MctsNode *nodes = s->arenas[s->current].nodes;
+
+    pthread_mutex_lock(&s->bestLock);
+    if (value > atomic_load_explicit(&s->bestReward, memory_order_relaxed)) {
+        s32 n = s->numCommitted;
+        memcpy(s->bestInputs, s->committed, n);
+        for (s32 i = 1; i < depth; i++) {
+            s->bestInputs[n++] = nodes[t->path[i]].rawStickY;
+        }
+        memcpy(&s->bestInputs[n], t->rollout, length);
+        s->bestLength = n + length;
+        atomic_store_explicit(&s->bestReward, value, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&s->bestLock);
+}
+
+static void mcts_iteration(void *arg, s32 index, s32 thread) {
+    (void) index;
+    struct MctsSearch *s = arg;
+    struct MctsThread *t = &s->threads[thread];
+    struct MctsNode *nodes = s->arenas[s->current].nodes;
+
+    // Select down to a leaf, expanding it if it can be
+    s32 depth = 0;
+    s32 current = 0;
+    t->path[depth++] = current;
+    atomic_fetch_add_explicit(&nodes[current].virtualLoss, 1, memory_order_relaxed);
+
+    while (TRUE) {
+        struct MctsNode *node = &nodes[current];
+        s32 firstChild = atomic_load_explicit(&node->firstChild, memory_order_acquire);
+        if (firstChild == MCTS_UNEXPANDED) {
+            if (!expand(s, node, t)) {
+                break;
+            }
+            firstChild = atomic_load_explicit(&node->firstChild, memory_order_acquire);
+        } else if (firstChild < 0) {
+            break;
+        }
+
+        current = select_child(s, node, firstChild);
+        t->path[depth++] = current;
+        atomic_fetch_add_explicit(&nodes[current].virtualLoss, 1, memory_order_relaxed);
+
+        // A new child gets its first rollout right away
+        if (atomic_load_explicit(&nodes[current].visits, memory_order_relaxed) == 0) {
+            break;
+        }
+    }
+
+    s32 length;
+    f64 value = rollout(s, &nodes[current], t, &length);
+
+    atomic_min_f64(&s->minReward, value);
+    atomic_max_f64(&s->maxReward, value);
+    for (s32 i = 0; i < depth; i++) {
+        struct MctsNode *node = &nodes[t->path[i]];
+        atomic_add_f64(&node->rewardSum, value);
+        atomic_fetch_add_explicit(&node->visits, 1, memory_order_relaxed);
+        atomic_fetch_sub_explicit(&node->virtualLoss, 1, memory_order_relaxed);
+    }
+
+    if (value > atomic_load_explicit(&s->bestReward, memory_order_relaxed)) {
+        record_best(s, t, depth, length, value);
+    }
+}
+
+// Copies the subtree of a root child to the other arena, breadth first so
+// siblings stay together. Nodes whose children don't fit, or that found the
+// old arena full, are left to be expanded again.
+static void move_root(struct MctsSearch *s, s32 newRoot) {
+    struct MctsArena *src = &s->arenas[s->current];
+    struct MctsArena *dst = &s->arenas[1 - s->current];
+
+    memcpy(&dst->nodes[0], &src->nodes[newRoot], sizeof(struct MctsNode));
+    s32 count = 1;
+    for (s32 i = 0; i < count; i++) {
+        struct MctsNode *node = &dst->nodes[i];
+        s32 firstChild = atomic_load_explicit(&node->firstChild, memory_order_relaxed);
+        if (firstChild == MCTS_FULL) {
+            atomic_store_explicit(&node->firstChild, MCTS_UNEXPANDED, memory_order_relaxed);
+            continue;
+        }
+        if (firstChild < 0) {
+            continue;
+        }
+        if (count + node->numChildren > dst->capacity) {
+            node->numChildren = 0;
+            atomic_store_explicit(&node->firstChild, MCTS_UNEXPANDED, memory_order_relaxed);
+            continue;
+        }
+        memcpy(&dst->nodes[count], &src->nodes[firstChild], node->numChildren * sizeof(struct MctsNode));
+        atomic_store_explicit(&node->firstChild, count, memory_order_relaxed);
+        count += node->numChildren;
+    }
+
+    atomic_store_explicit(&dst->count, count, memory_order_relaxed);
+    atomic_store_explicit(&src->count, 0, memory_order_relaxed);
+    s->current = 1 - s->current;
+}
+
+// Most visited child of the root, or -1 if it has none
+static s32 most_visited_child(struct MctsSearch *s) {
+    struct MctsNode *root = root_node(s);
+    struct MctsNode *nodes = s->arenas[s->current].nodes;
+    s32 firstChild = atomic_load_explicit(&root->firstChild, memory_order_relaxed);
+    s32 best = -1;
+
+    for (s32 i = firstChild; firstChild >= 0 && i < firstChild + root->numChildren; i++) {
+        s32 visits = atomic_load_explicit(&nodes[i].visits, memory_order_relaxed);
+        if (best < 0 || visits > atomic_load_explicit(&nodes[best].visits, memory_order_relaxed)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Identifies the search a checkpoint belongs to
+static u64 mcts_config(const struct MarioState *m, const struct MctsOptions *options) {
+    u64 memoryBytes = options->memoryBytes;
+    u64 hash = CHECKPOINT_HASH_INIT;
+
+    hash = checkpoint_hash(hash, &m->pos[1], sizeof(f32));
+    hash = checkpoint_hash(hash, &m->forwardVel, sizeof(f32));
+    hash = checkpoint_hash(hash, m->faceAngle, 3 * sizeof(s16));
+    hash = checkpoint_hash(hash, m->angleVel, 2 * sizeof(s16));
+    hash = checkpoint_hash(hash, &options->frames, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->iterations, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->score, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->exploration, sizeof(f32));
+    hash = checkpoint_hash(hash, &memoryBytes, sizeof(u64));
+    return hash;
+}
+
+struct MctsProgress
+{
+    s32 numCommitted;
+    s32 bestLength;
+    s32 numNodes;
+    s32 pad;
+    f64 minReward;
+    f64 maxReward;
+    f64 bestReward;
+};
+
+static void save_mcts(struct MctsSearch *s, u64 config) {
+    struct MctsArena *a = &s->arenas[s->current];
+    struct MctsProgress progress = { s->numCommitted, s->bestLength, atomic_load(&a->count), 0,
+        atomic_load(&s->minReward), atomic_load(&s->maxReward), atomic_load(&s->bestReward) };
+
+    struct CheckpointWriter w;
+    checkpoint_begin(&w, s->options->checkpoint.path, CHECKPOINT_MCTS, config);
+    checkpoint_write(&w, &progress, sizeof(progress));
+    checkpoint_write(&w, s->committed, s->numCommitted);
+    checkpoint_write(&w, s->bestInputs, s->bestLength);
+    checkpoint_write(&w, a->nodes, progress.numNodes * sizeof(struct MctsNode));
+    checkpoint_end(&w);
+}
+
+// Returns FALSE if there is no checkpoint to resume from
+static s32 load_mcts(struct MctsSearch *s, u64 config) {
+    struct MctsArena *a = &s->arenas[0];
+    struct CheckpointReader r;
+    struct MctsProgress progress;
+
+    if (!checkpoint_open(&r, s->options->checkpoint.path, CHECKPOINT_MCTS, config)) {
+        return FALSE;
+    }
+    checkpoint_read(&r, &progress, sizeof(progress));
+    if (progress.numCommitted < 0 || progress.numCommitted > s->options->frames || progress.bestLength < 0
+            || progress.bestLength > s->options->frames || progress.numNodes < 1 || progress.numNodes > a->capacity) {
+        printf("%s is corrupt\n", r.path);
+        exit(1);
+    }
+
+    s->numCommitted = progress.numCommitted;
+    s->bestLength = progress.bestLength;
+    atomic_store(&s->minReward, progress.minReward);
+    atomic_store(&s->maxReward, progress.maxReward);
+    atomic_store(&s->bestReward, progress.bestReward);
+    checkpoint_read(&r, s->committed, s->numCommitted);
+    checkpoint_read(&r, s->bestInputs, s->bestLength);
+    checkpoint_read(&r, a->nodes, progress.numNodes * sizeof(struct MctsNode));
+    checkpoint_close(&r);
+
+    // The only pointer in a node, which needn't be the same in this process
+    for (s32 i = 0; i < progress.numNodes; i++) {
+        a->nodes[i].policy.params = &gRunParamsDefault;
+    }
+    atomic_store(&a->count, progress.numNodes);
+    s->current = 0;
+    return TRUE;
+}
+
+void mcts_search(const struct MarioState *m, const struct MctsOptions *options,
+                 struct TasInputs *tasInputs, struct RunResult *result) {
+    struct MctsSearch s;
+    memset(&s, 0, sizeof(s));
+    s.options = options;
+
+    s32 capacity = (s32) min(options->memoryBytes / 2 / sizeof(struct MctsNode), (size_t) 0x7FFFFFFF - 256);
+    if (capacity < 1) {
+        printf("Not enough memory for the tree search\n");
+        exit(1);
+    }
+    for (s32 i = 0; i < 2; i++) {
+        s.arenas[i].nodes = mcts_alloc(capacity * sizeof(struct MctsNode));
+        s.arenas[i].capacity = capacity;
+        atomic_init(&s.arenas[i].count, 0);
+    }
+
+    s.committed = mcts_alloc(options->frames);
+    s.bestInputs = mcts_alloc(options->frames);
+    atomic_init(&s.bestReward, -INFINITY);
+    atomic_init(&s.minReward, INFINITY);
+    atomic_init(&s.maxReward, -INFINITY);
+    pthread_mutex_init(&s.bestLock, NULL);
+
+    s.threads = mcts_alloc(options->numThreads * sizeof(struct MctsThread));
+    for (s32 i = 0; i < options->numThreads; i++) {
+        s.threads[i].path = mcts_alloc((options->frames + 1) * sizeof(s32));
+        s.threads[i].rollout = mcts_alloc(options->frames);
+    }
+
+    struct MctsNode *root = &s.arenas[0].nodes[0];
+    root->rawStickY = 0;
+    root->frame = 0;
+    run_policy_init(&root->policy, m, &gRunParamsDefault);
+    root->maxY = m->pos[1];
+    root->framesToTarget = m->pos[1] >= RUN_TARGET_Y ? 0 : -1;
+    init_node(&s, root, m);
+    atomic_store(&s.arenas[0].count, 1);
+
+    u64 config = mcts_config(m, options);
+    if (options->checkpoint.path != NULL && load_mcts(&s, config)) {
+        if (options->verbose) {
+            printf("Resuming from %s at frame %d\n", options->checkpoint.path, s.numCommitted);
+        }
+    } else {
+        // The controller on its own is where the search starts from
+        s32 length;
+        s.threads[0].path[0] = 0;
+        f64 value = rollout(&s, root, &s.threads[0], &length);
+        atomic_store(&s.minReward, value);
+        atomic_store(&s.maxReward, value);
+        record_best(&s, &s.threads[0], 1, length, value);
+    }
+    f64 lastSave = checkpoint_clock();
+
+    while (s.numCommitted < options->frames) {
+        work_pool_run(options->iterations, options->numThreads, mcts_iteration, &s);
+
+        s32 next = most_visited_child(&s);
+        if (next < 0) {
+            break;
+        }
+        s.committed[s.numCommitted++] = s.arenas[s.current].nodes[next].rawStickY;
+        move_root(&s, next);
+
+        if (checkpoint_due(&options->checkpoint, &lastSave)) {
+            save_mcts(&s, config);
+        }
+
+        root = root_node(&s);
+        if (options->verbose && s.numCommitted % 100 == 0) {
+            printf("Frame %d: y = %f, v = %f, maxy = %f, best reward = %f, nodes = %d\n", s.numCommitted,
+                root->posY, root->forwardVel, root->maxY, atomic_load(&s.bestReward),
+                atomic_load(&s.arenas[s.current].count));
+        }
+    }
+
+    // Replay the best inputs for the exact outcome
+    struct MarioState replay = *m;
+    struct Controller controller;
+    replay.controller = &controller;
+    result->maxY = m->pos[1];
+    result->minY = m->pos[1];
+    result->framesToTarget = m->pos[1] >= RUN_TARGET_Y ? 0 : -1;
+    for (s32 i = 0; i < s.bestLength; i++) {
+        adjust_analog_stick(&controller, 0, s.bestInputs[i]);
+        act_flying(&replay, TRUE);
+        result->maxY = max(result->maxY, replay.pos[1]);
+        result->minY = min(result->minY, replay.pos[1]);
+        if (result->framesToTarget < 0 && result->maxY >= RUN_TARGET_Y) {
+            result->framesToTarget = i + 1;
+        }
+        if (tasInputs != NULL) {
+            tas_inputs_push(tasInputs, 0, 0, s.bestInputs[i]);
+        }
+    }
+    result->died = result->minY < RUN_DEATH_Y;
+    result->frames = s.bestLength;
+
+    for (s32 i = 0; i < options->numThreads; i++) {
+        free(s.threads[i].path);
+        free(s.threads[i].rollout);
+    }
+    free(s.threads);
+    pthread_mutex_destroy(&s.bestLock);
+    free(s.committed);
+    free(s.bestInputs);
+    free(s.arenas[0].nodes);
+    free(s.arenas[1].nodes);
+}
@@ -0,0 +1,59 @@
+#ifndef FLIGHT_MCTS_H_
+#define FLIGHT_MCTS_H_
+
+#include <stddef.h>
+
+#include "checkpoint.h"
+#include "flight_physics.h"
+#include "flight_run.h"
+#include "tas_inputs.h"
+
+
+enum MctsScore
+{
+    // Highest y reached within the frame budget
+    MCTS_SCORE_MAX_Y,
+    // Fewest frames to RUN_TARGET_Y, then highest y if it isn't reached
+    MCTS_SCORE_TARGET,
+    MCTS_SCORE_COUNT,
+};
+
+struct MctsOptions
+{
+    // Frames to plan from the initial state
+    s32 frames;
+    // Rollouts before committing to each frame's input
+    s32 iterations;
+    s32 score;
+    // UCT exploration constant, for rewards scaled to [0, 1]
+    f32 exploration;
+    s32 numThreads;
+    s32 verbose;
+    // Memory for tree nodes. Once it's used up, leaves are no longer expanded
+    // until committing to an input frees the branches not taken.
+    size_t memoryBytes;
+    // Saves the tree, the committed inputs and the best rollout after
+    // committing an input, and resumes from them. Only one thread gives the
+    // same result as an uninterrupted search, since more race on the tree.
+    struct CheckpointOptions checkpoint;
+};
+
+extern const char *gMctsScoreNames[MCTS_SCORE_COUNT];
+
+/**
+ * Monte Carlo tree search over stick inputs, one tree level per frame with one
+ * edge per distinct next pitch vel (see distinct_pitch_vel_inputs). Rollouts
+ * from the leaves fly the climb/dive controller of run() to the end of the
+ * frame budget, so the first rollout is exactly run() and the search only
+ * improves on it. Threads share the tree without locks, using virtual loss to
+ * spread out over different branches.
+ *
+ * After options->iterations rollouts the most visited input at the root is
+ * committed and its subtree becomes the new root. The inputs of the best
+ * rollout seen are appended to tasInputs unless it is NULL, and their outcome
+ * is stored in result.
+ */
+void mcts_search(const struct MarioState *m, const struct MctsOptions *options,
+                 struct TasInputs *tasInputs, struct RunResult *result);
+
+#endif
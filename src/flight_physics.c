@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_physics.h"
+#include "math_tables.h"
+
+
+void clear_mario_state(struct MarioState *m) {
+    struct Controller *c = m->controller;
+    memset(c, 0, sizeof(*c));
+    memset(m, 0, sizeof(*m));
+    m->controller = c;
+}
+
+static s32 raw_stick_in_range(s16 rawStickX, s16 rawStickY) {
+    return rawStickX >= -128 && rawStickX <= 127 && rawStickY >= -128 && rawStickY <= 127;
+}
+
+static void raw_stick_to_controller(struct Controller *controller, s16 rawStickX, s16 rawStickY)
+{
+    // reset the controller's x and y floats.
+    controller->stickX = 0;
+    controller->stickY = 0;
+
+    // modulate the rawStickX and rawStickY to be the new float values by adding/subtracting 6.
+    if(rawStickX <= -8)
+        controller->stickX = rawStickX + 6;
+
+    if(rawStickX >=  8)
+        controller->stickX = rawStickX - 6;
+
+    if(rawStickY <= -8)
+        controller->stickY = rawStickY + 6;
+
+    if(rawStickY >=  8)
+        controller->stickY = rawStickY - 6;
+
+    // calculate float magnitude from the center by vector length.
+    f32 stickMag = sqrtf(controller->stickX * controller->stickX
+                               + controller->stickY * controller->stickY);
+
+    // magnitude cannot exceed 64.0f: if it does, modify the values appropriately to
+    // flatten the values down to the allowed maximum value.
+    if(stickMag > 64)
+    {
+        controller->stickX  *= 64 / stickMag;
+        controller->stickY  *= 64 / stickMag;
+        stickMag = 64;
+    }
+}
+
+void adjust_analog_stick(struct Controller *controller, s16 rawStickX, s16 rawStickY)
+{
+    if (!raw_stick_in_range(rawStickX, rawStickY)) {
+        printf("Bad raw stick: %d %d\n", rawStickX, rawStickY);
+        exit(1);
+    }
+
+    raw_stick_to_controller(controller, rawStickX, rawStickY);
+}
+
+
+
+static void update_flying_yaw(struct MarioState *m)
+{
+    m->angleVel[1] = flying_yaw_vel(m->angleVel[1], m->controller->stickX, m->forwardVel);
+
+    m->faceAngle[1] += m->angleVel[1];
+    m->faceAngle[2] = 20 * -m->angleVel[1];
+}
+
+static void update_flying_pitch(struct MarioState *m)
+{
+    m->angleVel[0] = flying_pitch_vel(m->angleVel[0], m->controller->stickY, m->forwardVel);
+}
+
+// What one frame of flying does. Each mode below is a constant combination of
+// these, so the compiler drops the steps a mode leaves out and every branch on
+// them, down tilt included.
+enum FlyStep
+{
+    // Pitch vel follows the stick
+    FLY_PITCH_STICK = 1 << 0,
+    // Pitch drifts with speed and turns by pitch vel
+    FLY_PITCH_DRIFT = 1 << 1,
+    // Pitch is set to a given pitch instead, as if pitch vel were fully controlled
+    FLY_PITCH_SET = 1 << 2,
+    // Yaw vel follows the stick, and yaw and roll follow yaw vel
+    FLY_YAW_STICK = 1 << 3,
+    // Turning costs speed
+    FLY_YAW_DRAG = 1 << 4,
+    // movePitch follows pitch
+    FLY_MOVE_PITCH = 1 << 5,
+    // Move by vel[1] and tilt down, as when out of bounds
+    FLY_POS = 1 << 6,
+    FLY_DOWN_TILT = 1 << 7,
+};
+
+#define FLY_MODE_STICK (FLY_PITCH_STICK | FLY_PITCH_DRIFT | FLY_YAW_STICK | FLY_YAW_DRAG)
+#define FLY_MODE_CONTROLLED FLY_PITCH_SET
+#define FLY_MODE_NO_CONTROL (FLY_PITCH_DRIFT | FLY_YAW_DRAG | FLY_MOVE_PITCH)
+
+__attribute__((always_inline))
+static inline void fly_frame(struct MarioState *m, s16 movementPitch, const s32 steps)
+{
+    if (steps & FLY_PITCH_STICK)
+        update_flying_pitch(m);
+    if (steps & FLY_YAW_STICK)
+        update_flying_yaw(m);
+
+    m->forwardVel -= pitch_drag(m->faceAngle[0]);
+    if (steps & FLY_YAW_DRAG)
+        m->forwardVel -= 0.5f * (1.0f - coss(m->angleVel[1]));
+
+    if (m->forwardVel < 0.0f)
+        m->forwardVel = 0.0f;
+
+    if (steps & FLY_PITCH_DRIFT)
+    {
+        if (m->forwardVel > 16.0f)
+            m->faceAngle[0] += (m->forwardVel - 32.0f) * 6.0f;
+        else if (m->forwardVel > 4.0f)
+            m->faceAngle[0] += (m->forwardVel - 32.0f) * 10.0f;
+        else
+            m->faceAngle[0] -= 0x400;
+
+        m->faceAngle[0] += m->angleVel[0];
+    }
+    if (steps & FLY_PITCH_SET)
+        m->faceAngle[0] = movementPitch;
+
+    if (m->faceAngle[0] > 0x2AAA)
+        m->faceAngle[0] = 0x2AAA;
+    if (m->faceAngle[0] < -0x2AAA)
+        m->faceAngle[0] = -0x2AAA;
+
+    if (steps & FLY_MOVE_PITCH)
+        m->movePitch = m->faceAngle[0];
+
+    // One pair lookup per angle. Pitch is clamped by now, so its pair comes
+    // from the smaller pitch table.
+    const f32 *pitchSinCos = sincoss_pitch(m->faceAngle[0]);
+    const f32 *yawSinCos = sincoss(m->faceAngle[1]);
+
+    m->vel[0] = m->forwardVel * pitchSinCos[1] * yawSinCos[0];
+    m->vel[1] = m->forwardVel * pitchSinCos[0];
+    m->vel[2] = m->forwardVel * pitchSinCos[1] * yawSinCos[1];
+
+    if (steps & FLY_POS)
+        m->pos[1] += m->vel[1];
+
+    if (steps & FLY_DOWN_TILT) {
+        m->faceAngle[0] -= 0x200;
+        if (m->faceAngle[0] < -0x2AAA)
+            m->faceAngle[0] = -0x2AAA;
+    }
+}
+
+// One out of line copy per mode and down tilt
+#define DEFINE_FLY_MODE(name, steps)                                                    \
+    static void name(struct MarioState *m, s16 movementPitch) {                         \
+        fly_frame(m, movementPitch, (steps) | FLY_POS);                                  \
+    }                                                                                   \
+    static void name##_down_tilt(struct MarioState *m, s16 movementPitch) {             \
+        fly_frame(m, movementPitch, (steps) | FLY_POS | FLY_DOWN_TILT);                  \
+    }
+
+DEFINE_FLY_MODE(fly_stick, FLY_MODE_STICK)
+DEFINE_FLY_MODE(fly_controlled, FLY_MODE_CONTROLLED)
+DEFINE_FLY_MODE(fly_no_control, FLY_MODE_NO_CONTROL)
+
+void update_flying(struct MarioState *m)
+{
+    fly_frame(m, 0, FLY_MODE_STICK);
+}
+
+static void fly_one_frame(struct MarioState *m, s32 downTilt)
+{
+    if (downTilt)
+        fly_stick_down_tilt(m, 0);
+    else
+        fly_stick(m, 0);
+}
+
+s32 act_flying(struct MarioState *m, s32 downTilt)
+{
+    if (m->controller->stickY < -64 || m->controller->stickY > 64) {
+        printf("Invalid stickY = %f\n", m->controller->stickY);
+        exit(1);
+    }
+
+    fly_one_frame(m, downTilt);
+
+    return FALSE;
+}
+
+s32 act_flying_controlled(struct MarioState *m, s16 movementPitch, s32 downTilt)
+{
+    if (downTilt)
+        fly_controlled_down_tilt(m, movementPitch);
+    else
+        fly_controlled(m, movementPitch);
+
+    return FALSE;
+}
+
+s32 act_flying_no_control(struct MarioState *m, s32 downTilt)
+{
+    if (downTilt)
+        fly_no_control_down_tilt(m, 0);
+    else
+        fly_no_control(m, 0);
+
+    return FALSE;
+}
+
+
+void flight_state_from_mario(struct FlightState *s, const struct MarioState *m) {
+    s->posY = m->pos[1];
+    s->forwardVel = m->forwardVel;
+    s->pitch = m->faceAngle[0];
+    s->yaw = m->faceAngle[1];
+    s->pitchVel = m->angleVel[0];
+    s->yawVel = m->angleVel[1];
+}
+
+void flight_state_to_mario(const struct FlightState *s, struct MarioState *m) {
+    m->pos[1] = s->posY;
+    m->forwardVel = s->forwardVel;
+    m->faceAngle[0] = s->pitch;
+    m->faceAngle[1] = s->yaw;
+    m->faceAngle[2] = 20 * -s->yawVel;
+    m->angleVel[0] = s->pitchVel;
+    m->angleVel[1] = s->yawVel;
+}
+
+s32 flight_step(const struct FlightState *in, s16 rawStickX, s16 rawStickY, s32 downTilt, struct FlightState *out) {
+    if (!raw_stick_in_range(rawStickX, rawStickY)) {
+        return FLIGHT_BAD_STICK;
+    }
+
+    // act_flying on a scratch state. The stick is at most 64 after the
+    // adjustment, so its range check can't fail.
+    struct Controller c;
+    struct MarioState m;
+    m.controller = &c;
+    flight_state_to_mario(in, &m);
+    raw_stick_to_controller(&c, rawStickX, rawStickY);
+    fly_one_frame(&m, downTilt);
+
+    flight_state_from_mario(out, &m);
+    return FLIGHT_OK;
+}
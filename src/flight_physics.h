@@ -0,0 +1,129 @@
+#ifndef FLIGHT_PHYSICS_H_
+#define FLIGHT_PHYSICS_H_
+
+#include "math_util.h"
+
+
+struct Controller
+{
+  /*0x04*/ float stickX;        // [-64, 64] positive is right
+  /*0x08*/ float stickY;        // [-64, 64] positive is up
+};
+
+struct MarioState
+{
+    /*0x2C*/ Vec3s faceAngle;
+    /*0x32*/ Vec3s angleVel;
+    /*0x3C*/ Vec3f pos;
+    /*0x48*/ Vec3f vel;
+    /*0x54*/ f32 forwardVel;
+    /*0x9C*/ struct Controller *controller;
+
+    s16 movePitch;
+};
+
+/**
+ * The part of MarioState that flying reads or writes, minus what can be
+ * derived: roll is always 20 * -yaw vel, and velocity is recomputed from the
+ * angles each frame. movePitch is left out since only act_flying_no_control
+ * sets it, to the pitch. 16 bytes, with no pointers, so states can be packed
+ * into arrays and stepped from any thread.
+ */
+struct FlightState
+{
+    f32 posY;
+    f32 forwardVel;
+    s16 pitch;
+    s16 yaw;
+    s16 pitchVel;
+    s16 yawVel;
+};
+
+_Static_assert(sizeof(struct FlightState) == 16, "FlightState should pack into 16 bytes");
+
+enum FlightStatus
+{
+    FLIGHT_OK,
+    // A raw stick value outside [-128, 127]
+    FLIGHT_BAD_STICK,
+};
+
+/**
+ * How pitch vel (small = 0x20) and yaw vel (small = 0x10) move towards their
+ * target each frame: quickly back through zero, then by small or 2 * small.
+ * Shared by update_flying, the batch kernels and the controller.
+ */
+static inline s16 approach_angle_vel(s16 vel, s16 target, s32 small)
+{
+    if (target > 0)
+    {
+        if (vel < 0)
+        {
+            vel += 0x40;
+            if (vel > small)
+                vel = small;
+        }
+        else
+        {
+            vel = approach_s32(vel, target, small, 2 * small);
+        }
+    }
+    else if (target < 0)
+    {
+        if (vel > 0)
+        {
+            vel -= 0x40;
+            if (vel < -small)
+                vel = -small;
+        }
+        else
+        {
+            vel = approach_s32(vel, target, 2 * small, small);
+        }
+    }
+    else
+    {
+        vel = approach_s32(vel, 0, 0x40, 0x40);
+    }
+    return vel;
+}
+
+// Pitch and yaw vel after one frame of flying with the stick at stickY or stickX
+static inline s16 flying_pitch_vel(s16 pitchVel, f32 stickY, f32 forwardVel)
+{
+    return approach_angle_vel(pitchVel, -(s16) (stickY * (forwardVel / 5.0f)), 0x20);
+}
+
+static inline s16 flying_yaw_vel(s16 yawVel, f32 stickX, f32 forwardVel)
+{
+    return approach_angle_vel(yawVel, -(s16) (stickX * (forwardVel / 4.0f)), 0x10);
+}
+
+/**
+ * Speed lost each frame at a pitch, before yaw drag: 2 * (pitch / 0x4000) + 0.1.
+ * Scaling an integer pitch by a power of two is exact, so this is one multiply
+ * and bit identical to the game's divide and double.
+ */
+#define pitch_drag(pitch) ((f32) (pitch) * (1.0f / 0x2000) + 0.1f)
+
+void clear_mario_state(struct MarioState *m);
+void adjust_analog_stick(struct Controller *controller, s16 rawStickX, s16 rawStickY);
+
+void update_flying(struct MarioState *m);
+s32 act_flying(struct MarioState *m, s32 downTilt);
+s32 act_flying_controlled(struct MarioState *m, s16 movementPitch, s32 downTilt);
+s32 act_flying_no_control(struct MarioState *m, s32 downTilt);
+
+void flight_state_from_mario(struct FlightState *s, const struct MarioState *m);
+// Leaves m's other fields alone
+void flight_state_to_mario(const struct FlightState *s, struct MarioState *m);
+
+/**
+ * One frame of act_flying from in, with the stick given as raw values, stored
+ * in out (which can be in). Bit exact with adjust_analog_stick and act_flying,
+ * but touches nothing else and returns an error instead of exiting: out is
+ * left unchanged and FLIGHT_BAD_STICK is returned for out of range sticks.
+ */
+s32 flight_step(const struct FlightState *in, s16 rawStickX, s16 rawStickY, s32 downTilt, struct FlightState *out);
+
+#endif
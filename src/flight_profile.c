@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "flight_profile.h"
+
+#ifdef FLIGHT_PROFILE
+
+static const char *sStageNames[PROFILE_STAGE_COUNT] = {
+    "pitch target search",
+    "stick selection",
+    "adjust_analog_stick",
+    "act_flying",
+    "TAS output",
+    "min/max tracking",
+};
+
+static const char *sCounterNames[PROFILE_COUNTER_COUNT] = {
+    "min_pitch_vel_disp calls",
+    "  closed form",
+    "  integer pass iterations",
+    "  float loop iterations",
+};
+
+// Updated with relaxed atomics so profiling stays valid with several threads
+static u64 sStageTicks[PROFILE_STAGE_COUNT];
+static u64 sStageCalls[PROFILE_STAGE_COUNT];
+static u64 sCounters[PROFILE_COUNTER_COUNT];
+static s32 sRegistered;
+
+static void profile_print_summary(void) {
+    u64 total = 0;
+    for (s32 i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        total += sStageTicks[i];
+    }
+
+    fprintf(stderr, "\n%-28s %12s %12s %10s %7s\n", "stage", "calls", "total ms", "ns/call", "share");
+    for (s32 i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        fprintf(stderr, "%-28s %12llu %12.3f %10.1f %6.1f%%\n", sStageNames[i],
+            (unsigned long long) sStageCalls[i], sStageTicks[i] / 1e6,
+            sStageCalls[i] == 0 ? 0.0 : (f64) sStageTicks[i] / sStageCalls[i],
+            total == 0 ? 0.0 : 100.0 * sStageTicks[i] / total);
+    }
+
+    fprintf(stderr, "\n%-28s %12s\n", "counter", "count");
+    for (s32 i = 0; i < PROFILE_COUNTER_COUNT; i++) {
+        fprintf(stderr, "%-28s %12llu\n", sCounterNames[i], (unsigned long long) sCounters[i]);
+    }
+}
+
+static void profile_register(void) {
+    // A load first, so only the first call pays for a read-modify-write
+    if (!__atomic_load_n(&sRegistered, __ATOMIC_RELAXED)
+            && !__atomic_exchange_n(&sRegistered, TRUE, __ATOMIC_RELAXED)) {
+        atexit(profile_print_summary);
+    }
+}
+
+u64 profile_ticks(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (u64) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+void profile_add_time(s32 stage, u64 ticks) {
+    profile_register();
+    __atomic_fetch_add(&sStageTicks[stage], ticks, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&sStageCalls[stage], 1, __ATOMIC_RELAXED);
+}
+
+void profile_add_count(s32 counter, u64 count) {
+    profile_register();
+    __atomic_fetch_add(&sCounters[counter], count, __ATOMIC_RELAXED);
+}
+
+#endif
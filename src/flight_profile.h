@@ -0,0 +1,50 @@
+#ifndef FLIGHT_PROFILE_H_
+#define FLIGHT_PROFILE_H_
+
+#include "math_util.h"
+
+// Hot path instrumentation, compiled in with -DFLIGHT_PROFILE (the FLIGHT_PROFILE
+// CMake option). Without it every macro below expands to nothing. When enabled,
+// a summary table is printed at exit. Each PROFILE_COUNT is an atomic add, so
+// count loop iterations in a local and add them once per call.
+
+enum ProfileStage
+{
+    PROFILE_PITCH_TARGET,
+    PROFILE_STICK_SELECT,
+    PROFILE_ADJUST_STICK,
+    PROFILE_ACT_FLYING,
+    PROFILE_TAS_OUTPUT,
+    PROFILE_MIN_MAX,
+    PROFILE_STAGE_COUNT,
+};
+
+enum ProfileCounter
+{
+    PROFILE_DISP_CALLS,
+    PROFILE_DISP_CLOSED_FORM,
+    PROFILE_DISP_INT_ITERATIONS,
+    PROFILE_DISP_FLOAT_ITERATIONS,
+    PROFILE_COUNTER_COUNT,
+};
+
+#ifdef FLIGHT_PROFILE
+
+u64 profile_ticks(void);
+void profile_add_time(s32 stage, u64 ticks);
+void profile_add_count(s32 counter, u64 count);
+
+#define PROFILE_BEGIN(stage) u64 profileStart_##stage = profile_ticks()
+#define PROFILE_END(stage) profile_add_time(stage, profile_ticks() - profileStart_##stage)
+#define PROFILE_COUNT(counter, n) profile_add_count(counter, n)
+
+#else
+
+#define PROFILE_BEGIN(stage) ((void) 0)
+#define PROFILE_END(stage) ((void) 0)
+// n is still evaluated, so counts kept in locals don't trigger unused warnings
+#define PROFILE_COUNT(counter, n) ((void) (n))
+
+#endif
+
+#endif
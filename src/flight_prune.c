@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_prune.h"
+#include "flight_run.h"
+
+
+// The bounds assume no yaw drag, which holds with rawStickX = 0 once
+// angleVel[1] has settled at 0 as it does in every planner here.
+
+// Most speed a frame can add: drag at the lowest pitch, -0x2AAA
+#define MAX_SPEED_GAIN (2.0 * 0x2AAA / 0x4000 - 0.1)
+
+// Per frame, y + pi/8 * v^2 grows by at most SPEED_FACTOR * v + CONSTANT_GAIN.
+// With u = pitch / 0x4000 and the drag of the next frame taken at pitch - 0x200,
+// the growth is v * (sin(pi/2 u) - pi/2 u - 0.075 pi/8) + pi/8 * dv^2. The first
+// term peaks at u = -2/3 (0.1812, plus 0.0015 for the sine table's steps), and
+// dv^2 <= (4/3 + 0.0375)^2. Speed clamping at 0 adds at most 0.866 * 1.371.
+#define ENERGY_FACTOR (3.141592653589793 / 8)
+#define SPEED_FACTOR 0.154
+#define CONSTANT_GAIN 1.2
+
+// Pitch change from speed in update_flying, which never decreases with speed
+static f64 speed_pitch_jerk(f64 speed) {
+    if (speed > 16.0)
+        return (speed - 32.0) * 6.0;
+    else if (speed > 4.0)
+        return (speed - 32.0) * 10.0;
+    else
+        return -0x400;
+}
+
+static f64 clamp_pitch(f64 pitch) {
+    return min(max(pitch, -0x2AAA), 0x2AAA);
+}
+
+f32 min_y_bound(f32 posY, f32 forwardVel, s16 pitch, s16 pitchVel) {
+    f64 y = posY;
+    f64 speedLo = forwardVel;
+    f64 speedHi = forwardVel;
+    f64 pitchLo = pitch;
+    f64 pitchHi = pitch;
+    f64 pitchVelLo = pitchVel;
+    f64 pitchVelHi = pitchVel;
+
+    for (s32 frame = 0; frame < 256; frame++) {
+        // No stick changes pitch vel by more than 0x40 a frame
+        pitchVelLo -= 0x40;
+        pitchVelHi += 0x40;
+
+        // Drag uses the old pitch, height the new one
+        f64 newSpeedLo = max(speedLo - 2.0 * pitchHi / 0x4000 - 0.1, 0.0);
+        f64 newSpeedHi = max(speedHi - 2.0 * pitchLo / 0x4000 - 0.1, 0.0);
+
+        // +-1 for the truncation to s16
+        pitchLo = clamp_pitch(pitchLo + speed_pitch_jerk(newSpeedLo) + pitchVelLo - 1);
+        pitchHi = clamp_pitch(pitchHi + speed_pitch_jerk(newSpeedHi) + pitchVelHi + 1);
+
+        // From here on Mario may be able to climb
+        if (pitchHi >= 0) {
+            break;
+        }
+
+        // Slowest speed at the shallowest pitch. The sine table is increasing
+        // over [-0x2AAA, 0], so the entry for the rounded down pitch is an upper bound.
+        y += newSpeedLo * sins((s32) floor(pitchHi));
+
+        pitchLo = max(pitchLo - 0x200, -0x2AAA);
+        pitchHi = max(pitchHi - 0x200, -0x2AAA);
+        speedLo = newSpeedLo;
+        speedHi = newSpeedHi;
+    }
+
+    // Slack for the game's f32 rounding
+    return y + 1.0 + fabs(y) * 1e-5;
+}
+
+f32 max_speed_bound(f32 forwardVel, s16 pitch, s32 frames) {
+    if (frames <= 0) {
+        return forwardVel;
+    }
+
+    // The first frame's drag uses the current pitch
+    f64 speed = max(forwardVel - 2.0 * pitch / 0x4000 - 0.1, 0.0);
+    speed += MAX_SPEED_GAIN * (frames - 1);
+    return speed * (1 + 1e-5) + 1e-3;
+}
+
+f32 max_y_bound(f32 posY, f32 forwardVel, s16 pitch, s32 frames) {
+    if (frames <= 0) {
+        return posY;
+    }
+
+    // Speed used for the first frame's height, then the sum over n frames of
+    // SPEED_FACTOR * v_k + CONSTANT_GAIN with v_k <= v_1 + MAX_SPEED_GAIN * (k - 1)
+    f64 v1 = max(forwardVel - 2.0 * pitch / 0x4000 - 0.1, 0.0);
+    f64 n = frames;
+    f64 gain = SPEED_FACTOR * (n * v1 + MAX_SPEED_GAIN * n * (n - 1) / 2) + CONSTANT_GAIN * n;
+    f64 y = posY + ENERGY_FACTOR * v1 * v1 + gain;
+
+    return y + 1.0 + fabs(y) * 1e-5;
+}
+
+s32 prune_node(struct PruneStats *stats, f32 posY, f32 forwardVel, s16 pitch, s16 pitchVel,
+               f32 maxY, f32 incumbent, s32 framesLeft) {
+    stats->tested += 1;
+
+    if (min_y_bound(posY, forwardVel, pitch, pitchVel) < RUN_DEATH_Y) {
+        stats->cut[PRUNE_DEATH] += 1;
+        return PRUNE_DEATH;
+    }
+
+    if (maxY < incumbent && max_y_bound(posY, forwardVel, pitch, framesLeft) < incumbent) {
+        stats->cut[PRUNE_HEIGHT] += 1;
+        return PRUNE_HEIGHT;
+    }
+
+    return -1;
+}
+
+void prune_stats_add(struct PruneStats *total, const struct PruneStats *stats) {
+    total->tested += stats->tested;
+    for (s32 i = 0; i < PRUNE_BOUND_COUNT; i++) {
+        total->cut[i] += stats->cut[i];
+    }
+}
+
+void prune_print_stats(const struct PruneStats *stats, FILE *f) {
+    static const char *names[PRUNE_BOUND_COUNT] = { "death", "height" };
+
+    fprintf(f, "Pruned %lld of %lld nodes:", (long long)(stats->cut[PRUNE_DEATH] + stats->cut[PRUNE_HEIGHT]),
+        (long long) stats->tested);
+    for (s32 i = 0; i < PRUNE_BOUND_COUNT; i++) {
+        fprintf(f, " %s %lld (%.1f%%)", names[i], (long long) stats->cut[i],
+            stats->tested > 0 ? 100.0 * stats->cut[i] / stats->tested : 0.0);
+    }
+    fprintf(f, "\n");
+}
@@ -0,0 +1,57 @@
+#ifndef FLIGHT_PRUNE_H_
+#define FLIGHT_PRUNE_H_
+
+#include <stdio.h>
+
+#include "math_util.h"
+
+
+// Bounds on what any stick inputs can still achieve from a state with
+// downTilt set every frame. They are admissible (never too pessimistic), so a
+// planner that cuts nodes with them can't lose the optimum.
+
+/**
+ * Upper bound on the lowest y Mario has to pass through before he can be
+ * climbing again, like max_possible_min_y but safe: pitch and speed are
+ * tracked as intervals and pitch vel rises by the most any stick allows.
+ */
+f32 min_y_bound(f32 posY, f32 forwardVel, s16 pitch, s16 pitchVel);
+
+// Upper bound on forwardVel after the given number of frames
+f32 max_speed_bound(f32 forwardVel, s16 pitch, s32 frames);
+
+/**
+ * Upper bound on the highest y reached within the given number of frames.
+ * Diving can only raise y + pi/8 * forwardVel^2 by a fraction of the speed each
+ * frame, which bounds how much speed can be turned into height.
+ */
+f32 max_y_bound(f32 posY, f32 forwardVel, s16 pitch, s32 frames);
+
+enum PruneBound
+{
+    // Can't avoid dropping below RUN_DEATH_Y
+    PRUNE_DEATH,
+    // Can't climb above the incumbent before the frame budget runs out
+    PRUNE_HEIGHT,
+    PRUNE_BOUND_COUNT,
+};
+
+struct PruneStats
+{
+    s64 tested;
+    s64 cut[PRUNE_BOUND_COUNT];
+};
+
+/**
+ * Returns the first bound that rules the node out, or -1 to keep it. A node
+ * is cut by PRUNE_HEIGHT if neither maxY (the best y on its path so far) nor
+ * anything reachable in framesLeft frames gets above incumbent. Pass -INFINITY
+ * as the incumbent to only test for death.
+ */
+s32 prune_node(struct PruneStats *stats, f32 posY, f32 forwardVel, s16 pitch, s16 pitchVel,
+               f32 maxY, f32 incumbent, s32 framesLeft);
+
+void prune_stats_add(struct PruneStats *total, const struct PruneStats *stats);
+void prune_print_stats(const struct PruneStats *stats, FILE *f);
+
+#endif
@@ -0,0 +1,347 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_run.h"
+#include "flight_control.h"
+#include "flight_profile.h"
+
+
+#define PRINTF_HEX(x) ((x) < 0 ? "-" : ""), ((x) < 0 ? -(x) : (x))
+
+
+// static void run(struct MarioState *m) {
+//     clear_mario_state(m);
+// }
+
+
+// static void run(struct MarioState *m) {
+//     s32 frame = 0;
+
+//     m->pos[1] = 4000.0f;
+//     m->forwardVel = 30.0f;
+
+//     s32 phase = -1;
+
+//     f32 maxY = -1000000.0f;
+//     f32 maxV = -1000000.0f;
+
+//     while (1) {
+//         if (phase < 0) {
+//             m->controller->stickY = 64;
+//             if (m->pos[1] < 0) {
+//                 phase = 1;
+//                 // printf("(v) Frame %d: y = %f, v = %f\n", frame, m->pos[1], m->forwardVel);
+//             }
+//         } else {
+//             // target_pitch(m, 0x2000);
+//             m->controller->stickY = -32;
+//             if (m->pos[1] > 0) {
+//                 phase = -1;
+//                 // printf("(^) Frame %d: y = %f, v = %f\n", frame, m->pos[1], m->forwardVel);
+//             }
+//         }
+
+//         act_flying(m);
+
+//         frame += 1;
+
+//         s32 print = FALSE;
+//         if (m->pos[1] > maxY) {
+//             maxY = m->pos[1];
+//             print = TRUE;
+//         }
+//         if (m->forwardVel > maxV) {
+//             maxV = m->forwardVel;
+//             print = TRUE;
+//         }
+//         if (print) {
+//             printf("Frame %d: y = %f, v = %f\n", frame, m->pos[1], m->forwardVel);
+//         }
+//     }
+// }
+
+// // INSTANT PITCH CHANGE
+// static void run(struct MarioState *m) {
+//     s32 frame = 0;
+
+//     m->pos[1] = 0.0f;
+//     m->forwardVel = 50.0f;
+
+//     int phase = 1;
+//     s16 movePitch = 0;
+//     s16 maxChange = 0x200;
+
+//     while (frame < 10000) {
+//         if (phase == 1) {
+//             movePitch = approach_s32(movePitch, 0x11B0, maxChange, maxChange);
+//             act_flying_controlled(m, movePitch, TRUE);
+//             if (m->forwardVel < 20.0f) {
+//                 phase = -1;
+//                 printf("Frame %d: y = %f, v = %f\n", frame, m->pos[1], m->forwardVel);
+//             }
+//         } else {
+//             movePitch = approach_s32(movePitch, -0x2AAA, maxChange, maxChange);
+//             act_flying_controlled(m, movePitch, TRUE);
+//             if (m->pos[1] < -7500.0f) {
+//                 phase = 1;
+//                 // printf("Frame %d: y = %f, v = %f\n", frame, m->pos[1], m->forwardVel);
+//             }
+//         }
+
+//         frame += 1;
+//         // printf("Frame %d: y = %f, v = %f\n", frame, m->pos[1], m->forwardVel);
+//     }
+// }
+
+// In video: 21 min for y = 5629
+// Best: 3.93 minutes
+
+const struct RunParams gRunParamsDefault = {
+    .climbPitch = 0x1200,
+    .divePitch = -0x2AAA,
+    .climbMinSpeed = 30.0f,
+    .highThreshold = 3500,
+    .highDiveY = -3400,
+    .lowDiveDrop = 2500.0f,
+    .lowDiveSlack = 4200.0f,
+};
+
+const char *gRunStopReasonNames[RUN_STOPPED_COUNT] = { "frames", "target y", "target speed", "death" };
+
+const struct RunStop gRunStopFull = { 15000, 0, RUN_TARGET_Y, 0 };
+const struct RunStop gRunStopTarget = { 15000, RUN_STOP_TARGET_Y | RUN_STOP_DEATH, RUN_TARGET_Y, 0 };
+
+void run_policy_init(struct RunPolicy *p, const struct MarioState *m, const struct RunParams *params) {
+    p->params = params;
+    p->phase = -1;
+    p->startY = m->pos[1];
+    p->maxY = -1000000;
+}
+
+s16 run_policy_stick(const struct RunPolicy *p, struct MarioState *m, f32 *targetPitchVel) {
+    f32 pitchVel;
+    s16 rawStickY;
+
+    if (p->phase == 1) {
+        // s32 targetOffset = pitch_offset_for_move_pitch(m, 0x1280);
+        // targetPitchVel = pitch_vel_for_pitch_offset(targetOffset);
+        PROFILE_BEGIN(PROFILE_PITCH_TARGET);
+        pitchVel = pitch_vel_for_pitch(m, p->params->climbPitch);
+        PROFILE_END(PROFILE_PITCH_TARGET);
+        // if (m->angleVel[0] > 0x280) {
+        //     targetPitchVel = 0;
+        // }
+        // targetPitchVel = max(min(targetPitchVel, 0x204), -0x200);
+    } else {
+        // s32 targetOffset = pitch_offset_for_move_pitch(m, -0x2AAA + 0x200);
+        // targetPitchVel = pitch_vel_for_pitch_offset(targetOffset);
+        PROFILE_BEGIN(PROFILE_PITCH_TARGET);
+        pitchVel = pitch_vel_for_pitch(m, p->params->divePitch);
+        PROFILE_END(PROFILE_PITCH_TARGET);
+    }
+
+    PROFILE_BEGIN(PROFILE_STICK_SELECT);
+    rawStickY = approach_pitch_vel_raw_stick_y(m, pitchVel);
+    PROFILE_END(PROFILE_STICK_SELECT);
+
+    if (targetPitchVel != NULL) {
+        *targetPitchVel = pitchVel;
+    }
+    return rawStickY;
+}
+
+s32 run_policy_update(struct RunPolicy *p, const struct MarioState *m) {
+    s32 switched = FALSE;
+
+    if (p->phase == 1) {
+        if (m->forwardVel < p->params->climbMinSpeed) {
+            p->phase = -1;
+            switched = TRUE;
+        }
+    } else {
+        // TODO: Play with -2500 for higher sequences
+        // if (m->forwardVel > 160) {
+        // if (max_possible_min_y_after_down(m) < -6000) {
+        const struct RunParams *params = p->params;
+        if ((p->maxY < params->highThreshold &&
+                m->pos[1] - p->startY < max(p->maxY - p->startY - params->lowDiveSlack, 0) - params->lowDiveDrop) ||
+            (p->maxY >= params->highThreshold && m->pos[1] < params->highDiveY)) {
+            p->phase = 1;
+            switched = TRUE;
+        }
+    }
+
+    p->maxY = max(p->maxY, m->pos[1]);
+    return switched;
+}
+
+f32 run(struct MarioState *m, struct TasInputs *tasInputs, s32 verbose, struct RunResult *result) {
+    return run_with_params(m, &gRunParamsDefault, tasInputs, verbose, result);
+}
+
+f32 run_with_params(struct MarioState *m, const struct RunParams *params, struct TasInputs *tasInputs,
+                    s32 verbose, struct RunResult *result) {
+    struct RunResult r;
+    run_until(m, params, &gRunStopFull, tasInputs, verbose, &r);
+    if (result != NULL) {
+        *result = r;
+    }
+    return r.maxY;
+}
+
+s32 run_until(struct MarioState *m, const struct RunParams *params, const struct RunStop *stop,
+              struct TasInputs *tasInputs, s32 verbose, struct RunResult *result) {
+    s32 frame = 0;
+    s32 reason = RUN_STOPPED_FRAMES;
+
+    // First: 2279
+
+    // *(u32 *)&m->pos[1] = 0xC4C1F742;
+    // *(u32 *)&m->forwardVel = 0x42C7CD92;
+    // m->faceAngle[0] = -10922;
+    // m->angleVel[0] =  ;
+
+    // m->pos[1] = 0.0f;
+    // m->forwardVel = 100.0f;
+
+    // m->pos[1] -= 500;
+
+    struct RunPolicy policy;
+    // s16 movePitch = 0;
+    // s16 pitchVel = 0;
+    // s16 pitchAcc = 0x20;
+    // s16 maxVel = 0x100;
+    f32 minY = 1000000;
+    f32 maxY = -1000000;
+    f32 lastMaxY = maxY;
+
+    s16 rawStickY;
+
+    s32 totalFrames = -1;
+    s16 maxPitch = 0;
+    s32 printEachFrame = FALSE;
+
+    f32 initialY = m->pos[1];
+    f32 initialV = m->forwardVel;
+    s32 initialP = m->faceAngle[0];
+    s32 initialPV = m->angleVel[0];
+
+    run_policy_init(&policy, m, params);
+
+    // printf("%f\n", 2648 - startY);
+
+    // while (TRUE) {
+    while (frame < stop->maxFrames) {
+        f32 targetPitchVel;
+        rawStickY = run_policy_stick(&policy, m, &targetPitchVel);
+
+        PROFILE_BEGIN(PROFILE_ADJUST_STICK);
+        adjust_analog_stick(m->controller, 0, rawStickY);
+        PROFILE_END(PROFILE_ADJUST_STICK);
+
+        PROFILE_BEGIN(PROFILE_ACT_FLYING);
+        act_flying(m, TRUE);
+        PROFILE_END(PROFILE_ACT_FLYING);
+
+        if (run_policy_update(&policy, m)) {
+            // m->angleVel[0] = 0;
+            // printf("Frame %d: y = %f, v = %f, miny = %f, maxy = %f, maxp: %s0x%X\n", frame, m->pos[1], m->forwardVel, minY, maxY, PRINTF_HEX(maxPitch));
+            maxPitch = 0;
+
+            if (policy.phase < 0) {
+                if (verbose) {
+                    printf("%s Frame %d: y = %f, v = %f, miny = %f, maxy = %f, dmaxy = %f\n", policy.phase < 0 ? "v" : "^", frame, m->pos[1], m->forwardVel, minY, maxY, maxY - lastMaxY);
+                }
+                lastMaxY = maxY;
+                // minY = 100000;
+
+                if (frame > 39700) {
+                    printEachFrame = TRUE;
+                }
+            }
+        }
+
+        frame += 1;
+        if (verbose && printEachFrame) {
+            printf("%s Frame %d: sy = %d, y = %f, v = %f, p = %s0x%X, pv = %s0x%X, tpv = %s0x%X\n",
+                policy.phase < 0 ? "v" : "^",
+                frame,
+                rawStickY,
+                m->pos[1],
+                m->forwardVel,
+                PRINTF_HEX(m->faceAngle[0]),
+                PRINTF_HEX(m->angleVel[0]),
+                PRINTF_HEX((s16)targetPitchVel));
+        }
+        PROFILE_BEGIN(PROFILE_TAS_OUTPUT);
+        if (tasInputs != NULL) {
+            tas_inputs_push(tasInputs, 0, 0, rawStickY);
+        }
+        PROFILE_END(PROFILE_TAS_OUTPUT);
+
+        PROFILE_BEGIN(PROFILE_MIN_MAX);
+        if (m->pos[1] < minY) {
+            minY = m->pos[1];
+        }
+        if (m->pos[1] > maxY) {
+            maxY = m->pos[1];
+        }
+        if (m->faceAngle[0] > maxPitch) {
+            maxPitch = m->faceAngle[0];
+        }
+
+        if (maxY >= stop->targetY && totalFrames < 0) {
+            totalFrames = frame;
+        }
+        PROFILE_END(PROFILE_MIN_MAX);
+
+        if ((stop->flags & RUN_STOP_DEATH) && m->pos[1] < RUN_DEATH_Y) {
+            reason = RUN_STOPPED_DEATH;
+            break;
+        }
+        if ((stop->flags & RUN_STOP_TARGET_Y) && totalFrames >= 0) {
+            reason = RUN_STOPPED_TARGET_Y;
+            break;
+        }
+        if ((stop->flags & RUN_STOP_TARGET_SPEED) && m->forwardVel >= stop->targetSpeed) {
+            reason = RUN_STOPPED_TARGET_SPEED;
+            break;
+        }
+    }
+
+    if (verbose) {
+        printf("\nInitial state:\n");
+        printf("pos y = %f\n", initialY);
+        printf("h speed = %f\n", initialV);
+        printf("pitch = %d\n", initialP);
+        printf("pitch vel = %d\n", initialPV);
+
+        if (reason == RUN_STOPPED_FRAMES && frame == 15000) {
+            printf("\nSimulated 60 seconds\n");
+        } else {
+            printf("\nSimulated %d frames, stopped by %s\n", frame, gRunStopReasonNames[reason]);
+        }
+
+        if (minY < RUN_DEATH_Y) {
+            printf("Died (initial state might be too low. if you really need this, let me know and I might be able to make it work)\n");
+        } else {
+            printf("max y = %f\n", maxY);
+        }
+
+        if (totalFrames >= 0) {
+            printf("\nMinutes to %d: %f\n", (s32) stop->targetY, (f32)totalFrames / 30 / 60);
+        }
+    }
+
+    if (result != NULL) {
+        result->maxY = maxY;
+        result->minY = minY;
+        result->framesToTarget = totalFrames;
+        result->died = minY < RUN_DEATH_Y;
+        result->frames = frame;
+    }
+
+    return reason;
+}
@@ -0,0 +1,118 @@
+#ifndef FLIGHT_RUN_H_
+#define FLIGHT_RUN_H_
+
+#include "flight_physics.h"
+#include "tas_inputs.h"
+
+
+// Height the flight is trying to reach
+#define RUN_TARGET_Y 5629
+// Mario dies if he drops below this
+#define RUN_DEATH_Y (-8191 + 2048)
+
+struct RunResult
+{
+    f32 maxY;
+    f32 minY;
+    // First frame with maxY >= the target y (RUN_TARGET_Y unless a RunStop says
+    // otherwise), or -1 if it was never reached
+    s32 framesToTarget;
+    s32 died;
+    // Frames simulated, fewer than the budget if a stop condition ended the run
+    s32 frames;
+};
+
+enum RunStopFlags
+{
+    // Stop on the frame max y reaches targetY
+    RUN_STOP_TARGET_Y = 1 << 0,
+    // Stop on the frame speed reaches targetSpeed
+    RUN_STOP_TARGET_SPEED = 1 << 1,
+    // Stop on the frame Mario drops below RUN_DEATH_Y
+    RUN_STOP_DEATH = 1 << 2,
+};
+
+enum RunStopReason
+{
+    RUN_STOPPED_FRAMES,
+    RUN_STOPPED_TARGET_Y,
+    RUN_STOPPED_TARGET_SPEED,
+    RUN_STOPPED_DEATH,
+    RUN_STOPPED_COUNT,
+};
+
+extern const char *gRunStopReasonNames[RUN_STOPPED_COUNT];
+
+// When a run ends: after maxFrames, or earlier on whichever flagged condition
+// is met first
+struct RunStop
+{
+    s32 maxFrames;
+    s32 flags;
+    f32 targetY;
+    f32 targetSpeed;
+};
+
+// All 15000 frames, with frames to RUN_TARGET_Y recorded. What run() does.
+extern const struct RunStop gRunStopFull;
+// Stops as soon as RUN_TARGET_Y is reached or Mario dies, which settles
+// frames to target and death without flying the rest of the budget
+extern const struct RunStop gRunStopTarget;
+
+// Constants of the climb/dive controller
+struct RunParams
+{
+    // Pitches aimed for while climbing and diving
+    s32 climbPitch;
+    s32 divePitch;
+    // Speed below which a climb turns into a dive
+    f32 climbMinSpeed;
+    // Once max y reaches highThreshold, dives end below highDiveY. Before that
+    // they end lowDiveDrop below the start y, plus whatever max y gained over
+    // lowDiveSlack above the start.
+    f32 highThreshold;
+    f32 highDiveY;
+    f32 lowDiveDrop;
+    f32 lowDiveSlack;
+};
+
+// The hand tuned values: 0x1200, -0x2AAA, 30, 3500, -3400, 2500 and 4200
+extern const struct RunParams gRunParamsDefault;
+
+// State of the climb/dive controller: climb toward params->climbPitch until
+// speed drops too low, then dive at params->divePitch until Mario is low enough
+// to climb again
+struct RunPolicy
+{
+    const struct RunParams *params;
+    // 1 while climbing, -1 while diving
+    s32 phase;
+    f32 startY;
+    // Highest y seen by run_policy_update, -1000000 before the first frame
+    f32 maxY;
+};
+
+// Starts diving from the given state. params has to outlive the policy.
+void run_policy_init(struct RunPolicy *p, const struct MarioState *m, const struct RunParams *params);
+// Raw stick y for the next frame. Stores the pitch vel aimed for unless targetPitchVel is NULL.
+s16 run_policy_stick(const struct RunPolicy *p, struct MarioState *m, f32 *targetPitchVel);
+// Call after each act_flying. Returns TRUE if the phase changed.
+s32 run_policy_update(struct RunPolicy *p, const struct MarioState *m);
+
+/**
+ * Simulates 60 seconds of flight from the given state with the climb/dive
+ * controller, appending the inputs to tasInputs unless it is NULL. Progress
+ * and a summary are printed if verbose is set, and the outcome is stored in
+ * result unless it is NULL. Returns the max y.
+ */
+f32 run(struct MarioState *m, struct TasInputs *tasInputs, s32 verbose, struct RunResult *result);
+
+// run() with other controller constants
+f32 run_with_params(struct MarioState *m, const struct RunParams *params, struct TasInputs *tasInputs,
+                    s32 verbose, struct RunResult *result);
+
+// run_with_params with a stop condition. Returns why it stopped.
+s32 run_until(struct MarioState *m, const struct RunParams *params, const struct RunStop *stop,
+              struct TasInputs *tasInputs, s32 verbose, struct RunResult *result);
+
+#endif
@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_sweep.h"
+#include "flight_control.h"
+#include "flight_physics.h"
+#include "flight_run.h"
+#include "work_pool.h"
+
+
+// States per thread between checkpoints
+#define SWEEP_CHUNK_PER_THREAD 64
+
+// One field of a spec line: first + i * step for i in [0, count)
+struct SweepAxis
+{
+    f64 first;
+    f64 step;
+    s64 count;
+};
+
+void sweep_init(struct Sweep *s) {
+    memset(s, 0, sizeof(*s));
+    s->stop = gRunStopFull;
+}
+
+void sweep_free(struct Sweep *s) {
+    free(s->states);
+    free(s->results);
+    memset(s, 0, sizeof(*s));
+}
+
+static void sweep_push(struct Sweep *s, const struct SweepState *state) {
+    if (s->count == s->capacity) {
+        s->capacity = max(2 * s->capacity, 1024);
+        s->states = realloc(s->states, s->capacity * sizeof(struct SweepState));
+        if (s->states == NULL) {
+            printf("Failed to allocate %d sweep states\n", s->capacity);
+            exit(1);
+        }
+    }
+    s->states[s->count++] = *state;
+}
+
+// Floats are raw bits if they start with 0x, unless they're a step
+static s32 parse_value(const char *text, s32 isFloat, s32 isStep, f64 *value) {
+    char *end;
+
+    if (isFloat && !isStep && (strncmp(text, "0x", 2) == 0 || strncmp(text, "0X", 2) == 0)) {
+        u32 bits = strtoul(text, &end, 16);
+        f32 f;
+        memcpy(&f, &bits, sizeof(f32));
+        *value = f;
+    } else if (isFloat) {
+        *value = strtod(text, &end);
+    } else {
+        *value = strtol(text, &end, 0);
+    }
+    return end != text && *end == '\0';
+}
+
+static s32 parse_axis(char *text, s32 isFloat, struct SweepAxis *axis) {
+    char *parts[3] = { text, NULL, NULL };
+    s32 numParts = 1;
+
+    for (char *c = text; *c != '\0'; c++) {
+        if (*c == ':') {
+            if (numParts == 3) {
+                return FALSE;
+            }
+            *c = '\0';
+            parts[numParts++] = c + 1;
+        }
+    }
+
+    if (!parse_value(parts[0], isFloat, FALSE, &axis->first)) {
+        return FALSE;
+    }
+    if (numParts == 1) {
+        axis->step = 0;
+        axis->count = 1;
+        return TRUE;
+    }
+
+    f64 last;
+    if (numParts != 3 || !parse_value(parts[1], isFloat, FALSE, &last) ||
+            !parse_value(parts[2], isFloat, TRUE, &axis->step)) {
+        return FALSE;
+    }
+    if (axis->step == 0 || (last - axis->first) / axis->step < 0) {
+        return FALSE;
+    }
+
+    // Tolerance so that 0:1:0.1 includes 1
+    axis->count = (s64) floor((last - axis->first) / axis->step + 1e-9) + 1;
+    return axis->count <= 0x7FFFFFFF;
+}
+
+s32 sweep_read_spec(struct Sweep *s, FILE *f, const char *name) {
+    char line[512];
+    s32 lineNum = 0;
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        lineNum += 1;
+
+        char *comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+
+        char fields[5][128];
+        s32 numFields = sscanf(line, "%127s %127s %127s %127s %127s",
+            fields[0], fields[1], fields[2], fields[3], fields[4]);
+        if (numFields <= 0) {
+            continue;
+        }
+
+        struct SweepAxis axes[4];
+        s64 total = 1;
+        s32 ok = numFields == 4;
+        for (s32 i = 0; ok && i < 4; i++) {
+            ok = parse_axis(fields[i], i < 2, &axes[i]);
+            total *= ok ? axes[i].count : 1;
+        }
+        if (!ok) {
+            printf("%s:%d: expected <posy> <hspeed> <pitch> <pitch vel>, each a value or first:last:step\n",
+                name, lineNum);
+            return FALSE;
+        }
+        if (total > 0x7FFFFFFF - s->count) {
+            printf("%s:%d: too many states\n", name, lineNum);
+            return FALSE;
+        }
+
+        for (s64 a = 0; a < axes[0].count; a++) {
+            for (s64 b = 0; b < axes[1].count; b++) {
+                for (s64 c = 0; c < axes[2].count; c++) {
+                    for (s64 d = 0; d < axes[3].count; d++) {
+                        struct SweepState state;
+                        state.posY = (f32)(axes[0].first + a * axes[0].step);
+                        state.forwardVel = (f32)(axes[1].first + b * axes[1].step);
+                        state.pitch = (s32)(axes[2].first + c * axes[2].step);
+                        state.pitchVel = (s32)(axes[3].first + d * axes[3].step);
+                        sweep_push(s, &state);
+                    }
+                }
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+struct SweepChunk
+{
+    struct Sweep *sweep;
+    s32 first;
+};
+
+static void sweep_run_state(void *arg, s32 index, s32 thread) {
+    (void) thread;
+    struct SweepChunk *chunk = arg;
+    struct Sweep *s = chunk->sweep;
+    struct MarioState m;
+    struct Controller c;
+    struct RunResult result;
+
+    index += chunk->first;
+    m.controller = &c;
+    clear_mario_state(&m);
+    m.pos[1] = s->states[index].posY;
+    m.forwardVel = s->states[index].forwardVel;
+    m.faceAngle[0] = s->states[index].pitch;
+    m.angleVel[0] = s->states[index].pitchVel;
+
+    run_until(&m, &gRunParamsDefault, &s->stop, NULL, FALSE, &result);
+
+    s->results[index].maxY = result.maxY;
+    s->results[index].framesToTarget = result.framesToTarget;
+    s->results[index].died = result.died;
+    s->results[index].frames = result.frames;
+}
+
+// Identifies the spec and stop condition a checkpoint belongs to
+static u64 sweep_config(const struct Sweep *s) {
+    u64 hash = checkpoint_hash(CHECKPOINT_HASH_INIT, &s->count, sizeof(s->count));
+    hash = checkpoint_hash(hash, &s->stop.maxFrames, sizeof(s32));
+    hash = checkpoint_hash(hash, &s->stop.flags, sizeof(s32));
+    hash = checkpoint_hash(hash, &s->stop.targetY, sizeof(f32));
+    hash = checkpoint_hash(hash, &s->stop.targetSpeed, sizeof(f32));
+    for (s32 i = 0; i < s->count; i++) {
+        hash = checkpoint_hash(hash, &s->states[i].posY, sizeof(f32));
+        hash = checkpoint_hash(hash, &s->states[i].forwardVel, sizeof(f32));
+        hash = checkpoint_hash(hash, &s->states[i].pitch, sizeof(s16));
+        hash = checkpoint_hash(hash, &s->states[i].pitchVel, sizeof(s16));
+    }
+    return hash;
+}
+
+static void save_sweep(const struct Sweep *s, const char *path, u64 config, s32 done) {
+    struct CheckpointWriter w;
+    checkpoint_begin(&w, path, CHECKPOINT_SWEEP, config);
+    checkpoint_write(&w, &done, sizeof(done));
+    checkpoint_write(&w, s->results, done * sizeof(struct SweepResult));
+    checkpoint_end(&w);
+}
+
+// Returns how many states the checkpoint has results for
+static s32 load_sweep(struct Sweep *s, const char *path, u64 config) {
+    struct CheckpointReader r;
+    s32 done;
+
+    if (!checkpoint_open(&r, path, CHECKPOINT_SWEEP, config)) {
+        return 0;
+    }
+    checkpoint_read(&r, &done, sizeof(done));
+    if (done < 0 || done > s->count) {
+        printf("%s is corrupt\n", path);
+        exit(1);
+    }
+    checkpoint_read(&r, s->results, done * sizeof(struct SweepResult));
+    checkpoint_close(&r);
+    return done;
+}
+
+void sweep_run(struct Sweep *s, s32 numThreads, const struct CheckpointOptions *checkpoint) {
+    free(s->results);
+    s->results = malloc(max(s->count, 1) * sizeof(struct SweepResult));
+    if (s->results == NULL) {
+        printf("Failed to allocate %d sweep results\n", s->count);
+        exit(1);
+    }
+
+    struct SweepChunk chunk = { s, 0 };
+    if (checkpoint->path == NULL) {
+        work_pool_run(s->count, numThreads, sweep_run_state, &chunk);
+        return;
+    }
+
+    u64 config = sweep_config(s);
+    chunk.first = load_sweep(s, checkpoint->path, config);
+    if (chunk.first > 0) {
+        fprintf(stderr, "Resuming from %s after %d of %d states\n", checkpoint->path, chunk.first, s->count);
+    }
+
+    f64 lastSave = checkpoint_clock();
+    while (chunk.first < s->count) {
+        s32 count = min(s->count - chunk.first, SWEEP_CHUNK_PER_THREAD * numThreads);
+        work_pool_run(count, numThreads, sweep_run_state, &chunk);
+        chunk.first += count;
+
+        if (chunk.first == s->count || checkpoint_due(checkpoint, &lastSave)) {
+            save_sweep(s, checkpoint->path, config, chunk.first);
+        }
+    }
+}
+
+void sweep_write_results(const struct Sweep *s, FILE *f) {
+    fprintf(f, "# posy hspeed pitch pitch_vel max_y frames_to_%d died frames\n", (s32) s->stop.targetY);
+
+    for (s32 i = 0; i < s->count; i++) {
+        u32 posY;
+        u32 forwardVel;
+        memcpy(&posY, &s->states[i].posY, sizeof(u32));
+        memcpy(&forwardVel, &s->states[i].forwardVel, sizeof(u32));
+
+        fprintf(f, "0x%08X 0x%08X %d %d %f %d %d %d\n", posY, forwardVel, s->states[i].pitch,
+            s->states[i].pitchVel, s->results[i].maxY, s->results[i].framesToTarget, s->results[i].died,
+            s->results[i].frames);
+    }
+}
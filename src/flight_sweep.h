@@ -0,0 +1,62 @@
+#ifndef FLIGHT_SWEEP_H_
+#define FLIGHT_SWEEP_H_
+
+#include <stdio.h>
+
+#include "checkpoint.h"
+#include "flight_run.h"
+#include "math_util.h"
+
+
+// Initial state for run(), as given to the flight command
+struct SweepState
+{
+    f32 posY;
+    f32 forwardVel;
+    s16 pitch;
+    s16 pitchVel;
+};
+
+// Outcome of run() for one state
+struct SweepResult
+{
+    f32 maxY;
+    s32 framesToTarget;
+    s32 died;
+    // Fewer than the budget if the sweep's stop condition ended the run
+    s32 frames;
+};
+
+struct Sweep
+{
+    struct SweepState *states;
+    struct SweepResult *results;
+    s32 count;
+    s32 capacity;
+    // When each run ends, gRunStopFull after sweep_init
+    struct RunStop stop;
+};
+
+void sweep_init(struct Sweep *s);
+void sweep_free(struct Sweep *s);
+
+/**
+ * Reads initial states, one line each: <posy> <hspeed> <pitch> <pitch vel>.
+ * posy and hspeed are raw bits if they start with 0x and decimal values
+ * otherwise. Any field can instead be a range first:last:step, and the line
+ * then expands to every combination. Blank lines and # comments are skipped.
+ * Returns FALSE after printing an error if the spec is malformed.
+ */
+s32 sweep_read_spec(struct Sweep *s, FILE *f, const char *name);
+
+/**
+ * Runs every state on numThreads threads, filling in results. With a
+ * checkpoint path, states run in chunks and the results so far are saved
+ * between chunks, and a sweep of the same states resumes from them.
+ */
+void sweep_run(struct Sweep *s, s32 numThreads, const struct CheckpointOptions *checkpoint);
+
+// Writes one line per state, in spec order
+void sweep_write_results(const struct Sweep *s, FILE *f);
+
+#endif
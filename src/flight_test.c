@@ -0,0 +1,18 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "flight_check.h"
+
+
+// Test driver for ctest: the same checks as flight check, exiting nonzero if
+// any fail. --dominance runs the slow Pareto dominance check instead.
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "--dominance") == 0) {
+        return check_dominance() == 0 ? 0 : 1;
+    }
+    if (argc != 1) {
+        printf("Usage: flight_test [--dominance]\n");
+        return 1;
+    }
+    return run_checks() == 0 ? 0 : 1;
+}
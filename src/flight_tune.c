@@ -0,0 +1,261 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flight_tune.h"
+#include "cmaes.h"
+#include "flight_control.h"
+#include "work_pool.h"
+
+
+#define TUNE_PARAM_COUNT 7
+
+// The search runs over (param - default) / scale, so a step of 1 is about as
+// significant for every parameter. Values are clamped to [lo, hi].
+struct TuneAxis
+{
+    f64 scale;
+    f64 lo;
+    f64 hi;
+};
+
+static const struct TuneAxis sTuneAxes[TUNE_PARAM_COUNT] = {
+    { 0x400, -0x2AAA, 0x2AAA }, // climbPitch
+    { 0x400, -0x2AAA, 0x2AAA }, // divePitch
+    { 5, 1, 150 },              // climbMinSpeed
+    { 500, -8000, 20000 },      // highThreshold
+    { 500, -6000, 10000 },      // highDiveY
+    { 500, 0, 10000 },          // lowDiveDrop
+    { 500, 0, 20000 },          // lowDiveSlack
+};
+
+// Per unit of the search's scale, squared, by which a sample is out of bounds
+#define TUNE_BOUND_PENALTY 1000.0
+
+struct TuneSearch
+{
+    const struct SweepState *states;
+    s32 numStates;
+    struct RunParams *params;
+    struct RunResult *results;
+};
+
+f64 tune_cost(const struct RunResult *result) {
+    if (result->died) {
+        return 45000.0;
+    }
+    if (result->framesToTarget >= 0) {
+        return result->framesToTarget;
+    }
+    return 15000.0 + max(RUN_TARGET_Y - result->maxY, 0.0f);
+}
+
+static void params_to_vector(const struct RunParams *params, f64 *x) {
+    x[0] = params->climbPitch;
+    x[1] = params->divePitch;
+    x[2] = params->climbMinSpeed;
+    x[3] = params->highThreshold;
+    x[4] = params->highDiveY;
+    x[5] = params->lowDiveDrop;
+    x[6] = params->lowDiveSlack;
+}
+
+// Clamps a search point into bounds. Returns the penalty for how far out it was.
+static f64 vector_to_params(const f64 *u, struct RunParams *params) {
+    f64 x[TUNE_PARAM_COUNT];
+    f64 penalty = 0.0;
+
+    params_to_vector(&gRunParamsDefault, x);
+    for (s32 i = 0; i < TUNE_PARAM_COUNT; i++) {
+        const struct TuneAxis *axis = &sTuneAxes[i];
+        f64 value = x[i] + u[i] * axis->scale;
+        f64 clamped = min(max(value, axis->lo), axis->hi);
+        penalty += TUNE_BOUND_PENALTY * (value - clamped) * (value - clamped) / (axis->scale * axis->scale);
+        x[i] = clamped;
+    }
+
+    params->climbPitch = (s32) round(x[0]);
+    params->divePitch = (s32) round(x[1]);
+    params->climbMinSpeed = x[2];
+    params->highThreshold = x[3];
+    params->highDiveY = x[4];
+    params->lowDiveDrop = x[5];
+    params->lowDiveSlack = x[6];
+    return penalty;
+}
+
+static void tune_run(void *arg, s32 index, s32 thread) {
+    (void) thread;
+    struct TuneSearch *t = arg;
+    const struct SweepState *state = &t->states[index % t->numStates];
+    struct MarioState m;
+    struct Controller c;
+
+    m.controller = &c;
+    clear_mario_state(&m);
+    m.pos[1] = state->posY;
+    m.forwardVel = state->forwardVel;
+    m.faceAngle[0] = state->pitch;
+    m.angleVel[0] = state->pitchVel;
+
+    // The cost is settled once Mario reaches the target or dies
+    run_until(&m, &t->params[index / t->numStates], &gRunStopTarget, NULL, FALSE, &t->results[index]);
+}
+
+// Runs every parameter set on every state
+static void evaluate(struct TuneSearch *t, s32 numParams, s32 numThreads, f64 *costs) {
+    work_pool_run(numParams * t->numStates, numThreads, tune_run, t);
+
+    for (s32 k = 0; k < numParams; k++) {
+        f64 cost = 0.0;
+        for (s32 i = 0; i < t->numStates; i++) {
+            cost += tune_cost(&t->results[k * t->numStates + i]);
+        }
+        costs[k] = cost / t->numStates;
+    }
+}
+
+static void *tune_alloc(size_t size) {
+    void *p = malloc(max(size, 1));
+    if (p == NULL) {
+        printf("Failed to allocate %zu bytes for tuning\n", size);
+        exit(1);
+    }
+    return p;
+}
+
+// Identifies the search a checkpoint belongs to. Leaves out the number of
+// generations, so a finished search can be continued.
+static u64 tune_config(const struct SweepState *states, s32 numStates, const struct TuneOptions *options) {
+    u64 hash = checkpoint_hash(CHECKPOINT_HASH_INIT, &numStates, sizeof(s32));
+    for (s32 i = 0; i < numStates; i++) {
+        hash = checkpoint_hash(hash, &states[i].posY, sizeof(f32));
+        hash = checkpoint_hash(hash, &states[i].forwardVel, sizeof(f32));
+        hash = checkpoint_hash(hash, &states[i].pitch, sizeof(s16));
+        hash = checkpoint_hash(hash, &states[i].pitchVel, sizeof(s16));
+    }
+    hash = checkpoint_hash(hash, &options->population, sizeof(s32));
+    hash = checkpoint_hash(hash, &options->sigma, sizeof(f64));
+    hash = checkpoint_hash(hash, &options->seed, sizeof(u64));
+    return hash;
+}
+
+static void save_tune(const struct TuneOptions *options, u64 config, const struct Cmaes *cmaes, s32 numStates,
+                      const struct RunParams *best, const struct RunResult *bestResults, f64 bestCost) {
+    struct CheckpointWriter w;
+    checkpoint_begin(&w, options->checkpoint.path, CHECKPOINT_TUNE, config);
+    cmaes_save(cmaes, &w);
+    checkpoint_write(&w, best, sizeof(*best));
+    checkpoint_write(&w, bestResults, numStates * sizeof(struct RunResult));
+    checkpoint_write(&w, &bestCost, sizeof(bestCost));
+    checkpoint_end(&w);
+}
+
+// Returns FALSE if there is no checkpoint to resume from
+static s32 load_tune(const struct TuneOptions *options, u64 config, struct Cmaes *cmaes, s32 numStates,
+                     struct RunParams *best, struct RunResult *bestResults, f64 *bestCost) {
+    struct CheckpointReader r;
+    if (!checkpoint_open(&r, options->checkpoint.path, CHECKPOINT_TUNE, config)) {
+        return FALSE;
+    }
+    cmaes_load(cmaes, &r);
+    checkpoint_read(&r, best, sizeof(*best));
+    checkpoint_read(&r, bestResults, numStates * sizeof(struct RunResult));
+    checkpoint_read(&r, bestCost, sizeof(*bestCost));
+    checkpoint_close(&r);
+    return TRUE;
+}
+
+f64 tune_run_params(const struct SweepState *states, s32 numStates, const struct TuneOptions *options,
+                    struct RunParams *best, struct RunResult *bestResults) {
+    struct Cmaes cmaes;
+    f64 start[TUNE_PARAM_COUNT] = { 0 };
+    cmaes_init(&cmaes, TUNE_PARAM_COUNT, options->population, start, options->sigma, options->seed);
+
+    struct TuneSearch t;
+    t.states = states;
+    t.numStates = numStates;
+    t.params = tune_alloc(cmaes.lambda * sizeof(struct RunParams));
+    t.results = tune_alloc(cmaes.lambda * numStates * sizeof(struct RunResult));
+    f64 *costs = tune_alloc(cmaes.lambda * sizeof(f64));
+    f64 *penalized = tune_alloc(cmaes.lambda * sizeof(f64));
+
+    u64 config = tune_config(states, numStates, options);
+    f64 bestCost;
+    if (options->checkpoint.path != NULL
+            && load_tune(options, config, &cmaes, numStates, best, bestResults, &bestCost)) {
+        if (options->verbose) {
+            printf("Resuming from %s after %d generations: cost %.1f\n", options->checkpoint.path,
+                cmaes.generation, bestCost);
+        }
+    } else {
+        t.params[0] = gRunParamsDefault;
+        evaluate(&t, 1, options->numThreads, costs);
+        *best = gRunParamsDefault;
+        memcpy(bestResults, t.results, numStates * sizeof(struct RunResult));
+        bestCost = costs[0];
+        if (options->verbose) {
+            printf("Defaults: cost %.1f\n", bestCost);
+        }
+    }
+    f64 lastSave = checkpoint_clock();
+
+    for (s32 g = cmaes.generation; g < options->generations; g++) {
+        cmaes_sample(&cmaes);
+        for (s32 k = 0; k < cmaes.lambda; k++) {
+            penalized[k] = vector_to_params(&cmaes.samples[k * TUNE_PARAM_COUNT], &t.params[k]);
+        }
+        evaluate(&t, cmaes.lambda, options->numThreads, costs);
+        for (s32 k = 0; k < cmaes.lambda; k++) {
+            penalized[k] += costs[k];
+        }
+
+        f64 mean = 0.0;
+        s32 generationBest = 0;
+        for (s32 k = 0; k < cmaes.lambda; k++) {
+            mean += costs[k] / cmaes.lambda;
+            if (costs[k] < costs[generationBest]) {
+                generationBest = k;
+            }
+        }
+        if (costs[generationBest] < bestCost) {
+            bestCost = costs[generationBest];
+            *best = t.params[generationBest];
+            memcpy(bestResults, &t.results[generationBest * numStates], numStates * sizeof(struct RunResult));
+        }
+
+        // Out of bounds samples ran clamped, but steer the search back in
+        cmaes_update(&cmaes, penalized);
+
+        // Saved at the end too, so a finished search can be continued
+        if (checkpoint_due(&options->checkpoint, &lastSave)
+                || (options->checkpoint.path != NULL && g + 1 == options->generations)) {
+            save_tune(options, config, &cmaes, numStates, best, bestResults, bestCost);
+        }
+
+        if (options->verbose) {
+            printf("Generation %d: best %.1f, mean %.1f, sigma %.3f, best so far %.1f\n", g + 1,
+                costs[generationBest], mean, cmaes.sigma, bestCost);
+        }
+    }
+
+    free(t.params);
+    free(t.results);
+    free(costs);
+    free(penalized);
+    cmaes_free(&cmaes);
+    return bestCost;
+}
+
+void tune_print_params(const struct RunParams *params, FILE *f) {
+    fprintf(f, "{\n");
+    fprintf(f, "    .climbPitch = %s0x%X,\n", params->climbPitch < 0 ? "-" : "", abs(params->climbPitch));
+    fprintf(f, "    .divePitch = %s0x%X,\n", params->divePitch < 0 ? "-" : "", abs(params->divePitch));
+    fprintf(f, "    .climbMinSpeed = %.9g,\n", params->climbMinSpeed);
+    fprintf(f, "    .highThreshold = %.9g,\n", params->highThreshold);
+    fprintf(f, "    .highDiveY = %.9g,\n", params->highDiveY);
+    fprintf(f, "    .lowDiveDrop = %.9g,\n", params->lowDiveDrop);
+    fprintf(f, "    .lowDiveSlack = %.9g,\n", params->lowDiveSlack);
+    fprintf(f, "}\n");
+}
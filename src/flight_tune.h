@@ -0,0 +1,44 @@
+#ifndef FLIGHT_TUNE_H_
+#define FLIGHT_TUNE_H_
+
+#include "flight_run.h"
+#include "flight_sweep.h"
+
+
+struct TuneOptions
+{
+    s32 generations;
+    // Parameter sets evaluated per generation, 0 for the CMA-ES default
+    s32 population;
+    // Initial step size, in units of each parameter's scale (see flight_tune.c)
+    f64 sigma;
+    u64 seed;
+    s32 numThreads;
+    s32 verbose;
+    // Saves the CMA-ES state and the best set so far after each generation, and
+    // resumes from them. A checkpoint can be resumed with more generations.
+    struct CheckpointOptions checkpoint;
+};
+
+/**
+ * What the tuner minimizes for one run: frames to RUN_TARGET_Y if it was
+ * reached, otherwise 15000 plus how far below the target max y stayed, and
+ * 45000 if Mario died. Runs stop at the target, so dying after it doesn't count.
+ */
+f64 tune_cost(const struct RunResult *result);
+
+/**
+ * Searches the run() controller constants with CMA-ES, scoring each set by
+ * its mean tune_cost over the given initial states. Every run is a
+ * run_until with gRunStopTarget, and each generation's runs are spread over numThreads
+ * threads. The defaults are evaluated first, so the result is never worse.
+ * Stores the best set in best and its runs in bestResults (one per state).
+ * Returns its cost.
+ */
+f64 tune_run_params(const struct SweepState *states, s32 numStates, const struct TuneOptions *options,
+                    struct RunParams *best, struct RunResult *bestResults);
+
+// Prints the parameters as a RunParams initializer
+void tune_print_params(const struct RunParams *params, FILE *f);
+
+#endif
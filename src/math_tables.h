@@ -1,6153 +1,35 @@
-// these may have been generated by a tool such as 'maketable'
+#ifndef MATH_TABLES_H_
+#define MATH_TABLES_H_
 
-f32 gSineTable[] = {
-    0.00000000000000000000f,
-    0.00153398013208061457f,
-    0.00306795677170157433f,
-    0.00460192607715725899f,
-    0.00613588467240333557f,
-    0.00766982883214950562f,
-    0.00920375436544418335f,
-    0.01073765940964221954f,
-    0.01227153837680816650f,
-    0.01380538847297430038f,
-    0.01533920597285032272f,
-    0.01687298715114593506f,
-    0.01840673014521598816f,
-    0.01994042843580245972f,
-    0.02147408016026020050f,
-    0.02300768159329891205f,
-    0.02454122900962829590f,
-    0.02607471868395805359f,
-    0.02760814502835273743f,
-    0.02914150804281234741f,
-    0.03067480400204658508f,
-    0.03220802545547485352f,
-    0.03374117240309715271f,
-    0.03527423739433288574f,
-    0.03680722415447235107f,
-    0.03834012150764465332f,
-    0.03987292572855949402f,
-    0.04140564054250717163f,
-    0.04293825849890708923f,
-    0.04447077214717864990f,
-    0.04600318148732185364f,
-    0.04753548279404640198f,
-    0.04906767606735229492f,
-    0.05059975013136863708f,
-    0.05213170498609542847f,
-    0.05366353690624237061f,
-    0.05519524589180946350f,
-    0.05672682076692581177f,
-    0.05825826525688171387f,
-    0.05978957191109657288f,
-    0.06132073700428009033f,
-    0.06285175681114196777f,
-    0.06438262760639190674f,
-    0.06591334939002990723f,
-    0.06744392216205596924f,
-    0.06897433102130889893f,
-    0.07050457596778869629f,
-    0.07203464955091476440f,
-    0.07356456667184829712f,
-    0.07509429752826690674f,
-    0.07662386447191238403f,
-    0.07815324515104293823f,
-    0.07968243956565856934f,
-    0.08121144771575927734f,
-    0.08274026215076446533f,
-    0.08426889032125473022f,
-    0.08579730987548828125f,
-    0.08732553571462631226f,
-    0.08885355293750762939f,
-    0.09038136154413223267f,
-    0.09190895408391952515f,
-    0.09343633800745010376f,
-    0.09496349841356277466f,
-    0.09649042785167694092f,
-    0.09801714122295379639f,
-    0.09954361617565155029f,
-    0.10106986016035079956f,
-    0.10259586572647094727f,
-    0.10412163287401199341f,
-    0.10564715415239334106f,
-    0.10717242211103439331f,
-    0.10869744420051574707f,
-    0.11022220551967620850f,
-    0.11174671351909637451f,
-    0.11327095329761505127f,
-    0.11479492485523223877f,
-    0.11631862819194793701f,
-    0.11784206330776214600f,
-    0.11936521530151367188f,
-    0.12088808417320251465f,
-    0.12241067737340927124f,
-    0.12393297255039215088f,
-    0.12545497715473175049f,
-    0.12697669863700866699f,
-    0.12849810719490051270f,
-    0.13001921772956848145f,
-    0.13154003024101257324f,
-    0.13306052982807159424f,
-    0.13458070158958435059f,
-    0.13610057532787322998f,
-    0.13762012124061584473f,
-    0.13913933932781219482f,
-    0.14065824449062347412f,
-    0.14217680692672729492f,
-    0.14369502663612365723f,
-    0.14521291851997375488f,
-    0.14673046767711639404f,
-    0.14824767410755157471f,
-    0.14976453781127929688f,
-    0.15128104388713836670f,
-    0.15279719233512878418f,
-    0.15431296825408935547f,
-    0.15582840144634246826f,
-    0.15734346210956573486f,
-    0.15885815024375915527f,
-    0.16037245094776153564f,
-    0.16188639402389526367f,
-    0.16339994966983795166f,
-    0.16491311788558959961f,
-    0.16642589867115020752f,
-    0.16793829202651977539f,
-    0.16945029795169830322f,
-    0.17096188664436340332f,
-    0.17247308790683746338f,
-    0.17398387193679809570f,
-    0.17549425363540649414f,
-    0.17700421810150146484f,
-    0.17851376533508300781f,
-    0.18002289533615112305f,
-    0.18153160810470581055f,
-    0.18303988873958587646f,
-    0.18454773724079132080f,
-    0.18605515360832214355f,
-    0.18756212294101715088f,
-    0.18906866014003753662f,
-    0.19057475030422210693f,
-    0.19208039343357086182f,
-    0.19358558952808380127f,
-    0.19509032368659973145f,
-    0.19659459590911865234f,
-    0.19809840619564056396f,
-    0.19960175454616546631f,
-    0.20110464096069335938f,
-    0.20260703563690185547f,
-    0.20410896837711334229f,
-    0.20561040937900543213f,
-    0.20711137354373931885f,
-    0.20861184597015380859f,
-    0.21011184155941009521f,
-    0.21161133050918579102f,
-    0.21311031281948089600f,
-    0.21460881829261779785f,
-    0.21610680222511291504f,
-    0.21760427951812744141f,
-    0.21910123527050018311f,
-    0.22059768438339233398f,
-    0.22209362685680389404f,
-    0.22358903288841247559f,
-    0.22508391737937927246f,
-    0.22657826542854309082f,
-    0.22807207703590393066f,
-    0.22956536710262298584f,
-    0.23105810582637786865f,
-    0.23255030810832977295f,
-    0.23404195904731750488f,
-    0.23553305864334106445f,
-    0.23702360689640045166f,
-    0.23851358890533447266f,
-    0.24000301957130432129f,
-    0.24149188399314880371f,
-    0.24298018217086791992f,
-    0.24446789920330047607f,
-    0.24595504999160766602f,
-    0.24744161963462829590f,
-    0.24892760813236236572f,
-    0.25041300058364868164f,
-    0.25189781188964843750f,
-    0.25338202714920043945f,
-    0.25486564636230468750f,
-    0.25634866952896118164f,
-    0.25783109664916992188f,
-    0.25931292772293090820f,
-    0.26079410314559936523f,
-    0.26227471232414245605f,
-    0.26375466585159301758f,
-    0.26523402333259582520f,
-    0.26671275496482849121f,
-    0.26819086074829101562f,
-    0.26966831088066101074f,
-    0.27114516496658325195f,
-    0.27262136340141296387f,
-    0.27409690618515014648f,
-    0.27557182312011718750f,
-    0.27704608440399169922f,
-    0.27851969003677368164f,
-    0.27999264001846313477f,
-    0.28146493434906005859f,
-    0.28293657302856445312f,
-    0.28440752625465393066f,
-    0.28587782382965087891f,
-    0.28734746575355529785f,
-    0.28881642222404479980f,
-    0.29028466343879699707f,
-    0.29175224900245666504f,
-    0.29321914911270141602f,
-    0.29468536376953125000f,
-    0.29615089297294616699f,
-    0.29761570692062377930f,
-    0.29907983541488647461f,
-    0.30054324865341186523f,
-    0.30200594663619995117f,
-    0.30346795916557312012f,
-    0.30492922663688659668f,
-    0.30638980865478515625f,
-    0.30784964561462402344f,
-    0.30930876731872558594f,
-    0.31076714396476745605f,
-    0.31222480535507202148f,
-    0.31368175148963928223f,
-    0.31513792276382446289f,
-    0.31659337878227233887f,
-    0.31804808974266052246f,
-    0.31950202584266662598f,
-    0.32095524668693542480f,
-    0.32240769267082214355f,
-    0.32385936379432678223f,
-    0.32531028985977172852f,
-    0.32676044106483459473f,
-    0.32820984721183776855f,
-    0.32965844869613647461f,
-    0.33110630512237548828f,
-    0.33255335688591003418f,
-    0.33399966359138488770f,
-    0.33544513583183288574f,
-    0.33688986301422119141f,
-    0.33833375573158264160f,
-    0.33977687358856201172f,
-    0.34121921658515930176f,
-    0.34266072511672973633f,
-    0.34410142898559570312f,
-    0.34554132819175720215f,
-    0.34698042273521423340f,
-    0.34841868281364440918f,
-    0.34985613822937011719f,
-    0.35129275918006896973f,
-    0.35272854566574096680f,
-    0.35416352748870849609f,
-    0.35559767484664916992f,
-    0.35703095793724060059f,
-    0.35846340656280517578f,
-    0.35989505052566528320f,
-    0.36132580041885375977f,
-    0.36275571584701538086f,
-    0.36418479681015014648f,
-    0.36561298370361328125f,
-    0.36704033613204956055f,
-    0.36846682429313659668f,
-    0.36989244818687438965f,
-    0.37131720781326293945f,
-    0.37274107336997985840f,
-    0.37416407465934753418f,
-    0.37558618187904357910f,
-    0.37700742483139038086f,
-    0.37842774391174316406f,
-    0.37984719872474670410f,
-    0.38126575946807861328f,
-    0.38268342614173889160f,
-    0.38410019874572753906f,
-    0.38551604747772216797f,
-    0.38693100214004516602f,
-    0.38834503293037414551f,
-    0.38975816965103149414f,
-    0.39117038249969482422f,
-    0.39258167147636413574f,
-    0.39399203658103942871f,
-    0.39540147781372070312f,
-    0.39680999517440795898f,
-    0.39821755886077880859f,
-    0.39962419867515563965f,
-    0.40102988481521606445f,
-    0.40243464708328247070f,
-    0.40383845567703247070f,
-    0.40524131059646606445f,
-    0.40664321184158325195f,
-    0.40804415941238403320f,
-    0.40944415330886840820f,
-    0.41084316372871398926f,
-    0.41224122047424316406f,
-    0.41363832354545593262f,
-    0.41503441333770751953f,
-    0.41642954945564270020f,
-    0.41782370209693908691f,
-    0.41921690106391906738f,
-    0.42060908675193786621f,
-    0.42200025916099548340f,
-    0.42339047789573669434f,
-    0.42477968335151672363f,
-    0.42616787552833557129f,
-    0.42755508422851562500f,
-    0.42894127964973449707f,
-    0.43032649159431457520f,
-    0.43171066045761108398f,
-    0.43309381604194641113f,
-    0.43447595834732055664f,
-    0.43585708737373352051f,
-    0.43723717331886291504f,
-    0.43861624598503112793f,
-    0.43999427556991577148f,
-    0.44137126207351684570f,
-    0.44274723529815673828f,
-    0.44412213563919067383f,
-    0.44549602270126342773f,
-    0.44686883687973022461f,
-    0.44824060797691345215f,
-    0.44961133599281311035f,
-    0.45098099112510681152f,
-    0.45234957337379455566f,
-    0.45371711254119873047f,
-    0.45508357882499694824f,
-    0.45644897222518920898f,
-    0.45781329274177551270f,
-    0.45917654037475585938f,
-    0.46053871512413024902f,
-    0.46189978718757629395f,
-    0.46325978636741638184f,
-    0.46461868286132812500f,
-    0.46597650647163391113f,
-    0.46733319759368896484f,
-    0.46868881583213806152f,
-    0.47004333138465881348f,
-    0.47139674425125122070f,
-    0.47274902462959289551f,
-    0.47410020232200622559f,
-    0.47545027732849121094f,
-    0.47679921984672546387f,
-    0.47814705967903137207f,
-    0.47949376702308654785f,
-    0.48083934187889099121f,
-    0.48218378424644470215f,
-    0.48352706432342529297f,
-    0.48486924171447753906f,
-    0.48621028661727905273f,
-    0.48755016922950744629f,
-    0.48888888955116271973f,
-    0.49022647738456726074f,
-    0.49156290292739868164f,
-    0.49289819598197937012f,
-    0.49423229694366455078f,
-    0.49556526541709899902f,
-    0.49689704179763793945f,
-    0.49822765588760375977f,
-    0.49955710768699645996f,
-    0.50088536739349365234f,
-    0.50221246480941772461f,
-    0.50353837013244628906f,
-    0.50486308336257934570f,
-    0.50618666410446166992f,
-    0.50750899314880371094f,
-    0.50883013010025024414f,
-    0.51015007495880126953f,
-    0.51146882772445678711f,
-    0.51278638839721679688f,
-    0.51410275697708129883f,
-    0.51541787385940551758f,
-    0.51673179864883422852f,
-    0.51804453134536743164f,
-    0.51935601234436035156f,
-    0.52066624164581298828f,
-    0.52197527885437011719f,
-    0.52328312397003173828f,
-    0.52458965778350830078f,
-    0.52589499950408935547f,
-    0.52719914913177490234f,
-    0.52850198745727539062f,
-    0.52980363368988037109f,
-    0.53110402822494506836f,
-    0.53240311145782470703f,
-    0.53370100259780883789f,
-    0.53499764204025268555f,
-    0.53629297018051147461f,
-    0.53758704662322998047f,
-    0.53887993097305297852f,
-    0.54017144441604614258f,
-    0.54146176576614379883f,
-    0.54275077581405639648f,
-    0.54403853416442871094f,
-    0.54532498121261596680f,
-    0.54661017656326293945f,
-    0.54789406061172485352f,
-    0.54917663335800170898f,
-    0.55045795440673828125f,
-    0.55173796415328979492f,
-    0.55301672220230102539f,
-    0.55429410934448242188f,
-    0.55557024478912353516f,
-    0.55684500932693481445f,
-    0.55811852216720581055f,
-    0.55939072370529174805f,
-    0.56066155433654785156f,
-    0.56193113327026367188f,
-    0.56319934129714965820f,
-    0.56446623802185058594f,
-    0.56573182344436645508f,
-    0.56699603796005249023f,
-    0.56825894117355346680f,
-    0.56952053308486938477f,
-    0.57078075408935546875f,
-    0.57203960418701171875f,
-    0.57329714298248291016f,
-    0.57455337047576904297f,
-    0.57580816745758056641f,
-    0.57706165313720703125f,
-    0.57831376791000366211f,
-    0.57956457138061523438f,
-    0.58081394433975219727f,
-    0.58206200599670410156f,
-    0.58330863714218139648f,
-    0.58455395698547363281f,
-    0.58579784631729125977f,
-    0.58704036474227905273f,
-    0.58828157186508178711f,
-    0.58952128887176513672f,
-    0.59075969457626342773f,
-    0.59199666976928710938f,
-    0.59323227405548095703f,
-    0.59446650743484497070f,
-    0.59569931030273437500f,
-    0.59693068265914916992f,
-    0.59816068410873413086f,
-    0.59938931465148925781f,
-    0.60061645507812500000f,
-    0.60184222459793090820f,
-    0.60306662321090698242f,
-    0.60428953170776367188f,
-    0.60551106929779052734f,
-    0.60673111677169799805f,
-    0.60794979333877563477f,
-    0.60916703939437866211f,
-    0.61038279533386230469f,
-    0.61159718036651611328f,
-    0.61281007528305053711f,
-    0.61402153968811035156f,
-    0.61523157358169555664f,
-    0.61644017696380615234f,
-    0.61764729022979736328f,
-    0.61885297298431396484f,
-    0.62005722522735595703f,
-    0.62125998735427856445f,
-    0.62246125936508178711f,
-    0.62366110086441040039f,
-    0.62485951185226440430f,
-    0.62605637311935424805f,
-    0.62725180387496948242f,
-    0.62844574451446533203f,
-    0.62963825464248657227f,
-    0.63082921504974365234f,
-    0.63201874494552612305f,
-    0.63320678472518920898f,
-    0.63439327478408813477f,
-    0.63557833433151245117f,
-    0.63676184415817260742f,
-    0.63794392347335815430f,
-    0.63912445306777954102f,
-    0.64030349254608154297f,
-    0.64148104190826416016f,
-    0.64265704154968261719f,
-    0.64383155107498168945f,
-    0.64500451087951660156f,
-    0.64617604017257690430f,
-    0.64734596014022827148f,
-    0.64851438999176025391f,
-    0.64968132972717285156f,
-    0.65084666013717651367f,
-    0.65201056003570556641f,
-    0.65317285060882568359f,
-    0.65433359146118164062f,
-    0.65549284219741821289f,
-    0.65665054321289062500f,
-    0.65780669450759887695f,
-    0.65896129608154296875f,
-    0.66011434793472290039f,
-    0.66126585006713867188f,
-    0.66241580247879028320f,
-    0.66356414556503295898f,
-    0.66471099853515625000f,
-    0.66585624217987060547f,
-    0.66699993610382080078f,
-    0.66814202070236206055f,
-    0.66928261518478393555f,
-    0.67042154073715209961f,
-    0.67155897617340087891f,
-    0.67269474267959594727f,
-    0.67382901906967163086f,
-    0.67496162652969360352f,
-    0.67609268426895141602f,
-    0.67722219228744506836f,
-    0.67835003137588500977f,
-    0.67947632074356079102f,
-    0.68060100078582763672f,
-    0.68172407150268554688f,
-    0.68284553289413452148f,
-    0.68396538496017456055f,
-    0.68508368730545043945f,
-    0.68620032072067260742f,
-    0.68731534481048583984f,
-    0.68842875957489013672f,
-    0.68954056501388549805f,
-    0.69065070152282714844f,
-    0.69175922870635986328f,
-    0.69286614656448364258f,
-    0.69397145509719848633f,
-    0.69507509469985961914f,
-    0.69617712497711181641f,
-    0.69727748632431030273f,
-    0.69837623834609985352f,
-    0.69947332143783569336f,
-    0.70056879520416259766f,
-    0.70166260004043579102f,
-    0.70275473594665527344f,
-    0.70384526252746582031f,
-    0.70493406057357788086f,
-    0.70602124929428100586f,
-    0.70710676908493041992f,
-    0.70819061994552612305f,
-    0.70927280187606811523f,
-    0.71035337448120117188f,
-    0.71143221855163574219f,
-    0.71250939369201660156f,
-    0.71358484029769897461f,
-    0.71465867757797241211f,
-    0.71573084592819213867f,
-    0.71680128574371337891f,
-    0.71787005662918090820f,
-    0.71893709897994995117f,
-    0.72000253200531005859f,
-    0.72106617689132690430f,
-    0.72212821245193481445f,
-    0.72318845987319946289f,
-    0.72424709796905517578f,
-    0.72530394792556762695f,
-    0.72635912895202636719f,
-    0.72741264104843139648f,
-    0.72846436500549316406f,
-    0.72951442003250122070f,
-    0.73056274652481079102f,
-    0.73160940408706665039f,
-    0.73265427350997924805f,
-    0.73369741439819335938f,
-    0.73473888635635375977f,
-    0.73577857017517089844f,
-    0.73681658506393432617f,
-    0.73785281181335449219f,
-    0.73888731002807617188f,
-    0.73992007970809936523f,
-    0.74095112085342407227f,
-    0.74198043346405029297f,
-    0.74300795793533325195f,
-    0.74403375387191772461f,
-    0.74505776166915893555f,
-    0.74608010053634643555f,
-    0.74710059165954589844f,
-    0.74811935424804687500f,
-    0.74913638830184936523f,
-    0.75015163421630859375f,
-    0.75116515159606933594f,
-    0.75217682123184204102f,
-    0.75318682193756103516f,
-    0.75419497489929199219f,
-    0.75520139932632446289f,
-    0.75620597600936889648f,
-    0.75720882415771484375f,
-    0.75820988416671752930f,
-    0.75920921564102172852f,
-    0.76020669937133789062f,
-    0.76120239496231079102f,
-    0.76219630241394042969f,
-    0.76318842172622680664f,
-    0.76417875289916992188f,
-    0.76516723632812500000f,
-    0.76615399122238159180f,
-    0.76713889837265014648f,
-    0.76812201738357543945f,
-    0.76910334825515747070f,
-    0.77008283138275146484f,
-    0.77106052637100219727f,
-    0.77203637361526489258f,
-    0.77301043272018432617f,
-    0.77398270368576049805f,
-    0.77495312690734863281f,
-    0.77592170238494873047f,
-    0.77688848972320556641f,
-    0.77785342931747436523f,
-    0.77881652116775512695f,
-    0.77977776527404785156f,
-    0.78073722124099731445f,
-    0.78169482946395874023f,
-    0.78265058994293212891f,
-    0.78360450267791748047f,
-    0.78455656766891479492f,
-    0.78550684452056884766f,
-    0.78645521402359008789f,
-    0.78740173578262329102f,
-    0.78834640979766845703f,
-    0.78928923606872558594f,
-    0.79023021459579467773f,
-    0.79116934537887573242f,
-    0.79210656881332397461f,
-    0.79304194450378417969f,
-    0.79397547245025634766f,
-    0.79490715265274047852f,
-    0.79583692550659179688f,
-    0.79676479101181030273f,
-    0.79769086837768554688f,
-    0.79861497879028320312f,
-    0.79953724145889282227f,
-    0.80045765638351440430f,
-    0.80137616395950317383f,
-    0.80229282379150390625f,
-    0.80320751667022705078f,
-    0.80412036180496215820f,
-    0.80503135919570922852f,
-    0.80594038963317871094f,
-    0.80684757232666015625f,
-    0.80775284767150878906f,
-    0.80865615606307983398f,
-    0.80955761671066284180f,
-    0.81045717000961303711f,
-    0.81135487556457519531f,
-    0.81225061416625976562f,
-    0.81314438581466674805f,
-    0.81403630971908569336f,
-    0.81492632627487182617f,
-    0.81581443548202514648f,
-    0.81670057773590087891f,
-    0.81758481264114379883f,
-    0.81846714019775390625f,
-    0.81934750080108642578f,
-    0.82022595405578613281f,
-    0.82110249996185302734f,
-    0.82197713851928710938f,
-    0.82284981012344360352f,
-    0.82372051477432250977f,
-    0.82458931207656860352f,
-    0.82545614242553710938f,
-    0.82632106542587280273f,
-    0.82718402147293090820f,
-    0.82804507017135620117f,
-    0.82890409231185913086f,
-    0.82976120710372924805f,
-    0.83061641454696655273f,
-    0.83146959543228149414f,
-    0.83232086896896362305f,
-    0.83317017555236816406f,
-    0.83401751518249511719f,
-    0.83486288785934448242f,
-    0.83570629358291625977f,
-    0.83654773235321044922f,
-    0.83738720417022705078f,
-    0.83822470903396606445f,
-    0.83906024694442749023f,
-    0.83989381790161132812f,
-    0.84072536230087280273f,
-    0.84155499935150146484f,
-    0.84238260984420776367f,
-    0.84320825338363647461f,
-    0.84403187036514282227f,
-    0.84485357999801635742f,
-    0.84567326307296752930f,
-    0.84649091958999633789f,
-    0.84730660915374755859f,
-    0.84812033176422119141f,
-    0.84893202781677246094f,
-    0.84974175691604614258f,
-    0.85054945945739746094f,
-    0.85135519504547119141f,
-    0.85215890407562255859f,
-    0.85296058654785156250f,
-    0.85376030206680297852f,
-    0.85455799102783203125f,
-    0.85535365343093872070f,
-    0.85614734888076782227f,
-    0.85693895816802978516f,
-    0.85772860050201416016f,
-    0.85851621627807617188f,
-    0.85930180549621582031f,
-    0.86008536815643310547f,
-    0.86086696386337280273f,
-    0.86164647340774536133f,
-    0.86242395639419555664f,
-    0.86319941282272338867f,
-    0.86397284269332885742f,
-    0.86474424600601196289f,
-    0.86551362276077270508f,
-    0.86628097295761108398f,
-    0.86704623699188232422f,
-    0.86780947446823120117f,
-    0.86857068538665771484f,
-    0.86932986974716186523f,
-    0.87008696794509887695f,
-    0.87084203958511352539f,
-    0.87159508466720581055f,
-    0.87234604358673095703f,
-    0.87309497594833374023f,
-    0.87384182214736938477f,
-    0.87458664178848266602f,
-    0.87532937526702880859f,
-    0.87607008218765258789f,
-    0.87680870294570922852f,
-    0.87754529714584350586f,
-    0.87827980518341064453f,
-    0.87901222705841064453f,
-    0.87974262237548828125f,
-    0.88047087192535400391f,
-    0.88119709491729736328f,
-    0.88192129135131835938f,
-    0.88264334201812744141f,
-    0.88336336612701416016f,
-    0.88408124446868896484f,
-    0.88479709625244140625f,
-    0.88551086187362670898f,
-    0.88622254133224487305f,
-    0.88693213462829589844f,
-    0.88763964176177978516f,
-    0.88834506273269653320f,
-    0.88904833793640136719f,
-    0.88974958658218383789f,
-    0.89044874906539916992f,
-    0.89114576578140258789f,
-    0.89184069633483886719f,
-    0.89253354072570800781f,
-    0.89322429895401000977f,
-    0.89391297101974487305f,
-    0.89459949731826782227f,
-    0.89528393745422363281f,
-    0.89596623182296752930f,
-    0.89664649963378906250f,
-    0.89732456207275390625f,
-    0.89800059795379638672f,
-    0.89867448806762695312f,
-    0.89934623241424560547f,
-    0.90001589059829711914f,
-    0.90068340301513671875f,
-    0.90134882926940917969f,
-    0.90201216936111450195f,
-    0.90267330408096313477f,
-    0.90333235263824462891f,
-    0.90398931503295898438f,
-    0.90464407205581665039f,
-    0.90529674291610717773f,
-    0.90594726800918579102f,
-    0.90659570693969726562f,
-    0.90724200010299682617f,
-    0.90788608789443969727f,
-    0.90852808952331542969f,
-    0.90916800498962402344f,
-    0.90980571508407592773f,
-    0.91044127941131591797f,
-    0.91107475757598876953f,
-    0.91170603036880493164f,
-    0.91233515739440917969f,
-    0.91296219825744628906f,
-    0.91358703374862670898f,
-    0.91420978307723999023f,
-    0.91483032703399658203f,
-    0.91544872522354125977f,
-    0.91606497764587402344f,
-    0.91667908430099487305f,
-    0.91729098558425903320f,
-    0.91790080070495605469f,
-    0.91850841045379638672f,
-    0.91911387443542480469f,
-    0.91971713304519653320f,
-    0.92031830549240112305f,
-    0.92091721296310424805f,
-    0.92151403427124023438f,
-    0.92210865020751953125f,
-    0.92270112037658691406f,
-    0.92329144477844238281f,
-    0.92387950420379638672f,
-    0.92446547746658325195f,
-    0.92504924535751342773f,
-    0.92563080787658691406f,
-    0.92621022462844848633f,
-    0.92678749561309814453f,
-    0.92736250162124633789f,
-    0.92793542146682739258f,
-    0.92850607633590698242f,
-    0.92907458543777465820f,
-    0.92964088916778564453f,
-    0.93020504713058471680f,
-    0.93076694011688232422f,
-    0.93132668733596801758f,
-    0.93188428878784179688f,
-    0.93243962526321411133f,
-    0.93299281597137451172f,
-    0.93354380130767822266f,
-    0.93409252166748046875f,
-    0.93463915586471557617f,
-    0.93518352508544921875f,
-    0.93572568893432617188f,
-    0.93626564741134643555f,
-    0.93680346012115478516f,
-    0.93733900785446166992f,
-    0.93787235021591186523f,
-    0.93840354681015014648f,
-    0.93893247842788696289f,
-    0.93945920467376708984f,
-    0.93998372554779052734f,
-    0.94050604104995727539f,
-    0.94102615118026733398f,
-    0.94154405593872070312f,
-    0.94205975532531738281f,
-    0.94257318973541259766f,
-    0.94308441877365112305f,
-    0.94359344244003295898f,
-    0.94410026073455810547f,
-    0.94460481405258178711f,
-    0.94510722160339355469f,
-    0.94560730457305908203f,
-    0.94610524177551269531f,
-    0.94660091400146484375f,
-    0.94709438085556030273f,
-    0.94758558273315429688f,
-    0.94807457923889160156f,
-    0.94856137037277221680f,
-    0.94904589653015136719f,
-    0.94952815771102905273f,
-    0.95000827312469482422f,
-    0.95048606395721435547f,
-    0.95096164941787719727f,
-    0.95143502950668334961f,
-    0.95190614461898803711f,
-    0.95237499475479125977f,
-    0.95284163951873779297f,
-    0.95330601930618286133f,
-    0.95376819372177124023f,
-    0.95422810316085815430f,
-    0.95468574762344360352f,
-    0.95514118671417236328f,
-    0.95559436082839965820f,
-    0.95604526996612548828f,
-    0.95649391412734985352f,
-    0.95694035291671752930f,
-    0.95738452672958374023f,
-    0.95782643556594848633f,
-    0.95826607942581176758f,
-    0.95870345830917358398f,
-    0.95913863182067871094f,
-    0.95957154035568237305f,
-    0.96000212430953979492f,
-    0.96043050289154052734f,
-    0.96085661649703979492f,
-    0.96128046512603759766f,
-    0.96170204877853393555f,
-    0.96212142705917358398f,
-    0.96253848075866699219f,
-    0.96295326948165893555f,
-    0.96336579322814941406f,
-    0.96377605199813842773f,
-    0.96418404579162597656f,
-    0.96458977460861206055f,
-    0.96499323844909667969f,
-    0.96539443731307983398f,
-    0.96579337120056152344f,
-    0.96618998050689697266f,
-    0.96658438444137573242f,
-    0.96697646379470825195f,
-    0.96736627817153930664f,
-    0.96775382757186889648f,
-    0.96813911199569702148f,
-    0.96852207183837890625f,
-    0.96890282630920410156f,
-    0.96928125619888305664f,
-    0.96965736150741577148f,
-    0.97003126144409179688f,
-    0.97040283679962158203f,
-    0.97077214717864990234f,
-    0.97113913297653198242f,
-    0.97150391340255737305f,
-    0.97186630964279174805f,
-    0.97222650051116943359f,
-    0.97258436679840087891f,
-    0.97293996810913085938f,
-    0.97329324483871459961f,
-    0.97364425659179687500f,
-    0.97399294376373291016f,
-    0.97433936595916748047f,
-    0.97468352317810058594f,
-    0.97502535581588745117f,
-    0.97536486387252807617f,
-    0.97570210695266723633f,
-    0.97603708505630493164f,
-    0.97636973857879638672f,
-    0.97670006752014160156f,
-    0.97702813148498535156f,
-    0.97735387086868286133f,
-    0.97767734527587890625f,
-    0.97799849510192871094f,
-    0.97831737995147705078f,
-    0.97863394021987915039f,
-    0.97894817590713500977f,
-    0.97926014661788940430f,
-    0.97956979274749755859f,
-    0.97987711429595947266f,
-    0.98018211126327514648f,
-    0.98048484325408935547f,
-    0.98078525066375732422f,
-    0.98108339309692382812f,
-    0.98137921094894409180f,
-    0.98167270421981811523f,
-    0.98196387290954589844f,
-    0.98225271701812744141f,
-    0.98253929615020751953f,
-    0.98282355070114135742f,
-    0.98310548067092895508f,
-    0.98338508605957031250f,
-    0.98366242647171020508f,
-    0.98393744230270385742f,
-    0.98421007394790649414f,
-    0.98448044061660766602f,
-    0.98474848270416259766f,
-    0.98501425981521606445f,
-    0.98527765274047851562f,
-    0.98553872108459472656f,
-    0.98579752445220947266f,
-    0.98605394363403320312f,
-    0.98630809783935546875f,
-    0.98655992746353149414f,
-    0.98680937290191650391f,
-    0.98705655336380004883f,
-    0.98730140924453735352f,
-    0.98754394054412841797f,
-    0.98778414726257324219f,
-    0.98802202939987182617f,
-    0.98825758695602416992f,
-    0.98849081993103027344f,
-    0.98872166872024536133f,
-    0.98895025253295898438f,
-    0.98917651176452636719f,
-    0.98940044641494750977f,
-    0.98962199687957763672f,
-    0.98984128236770629883f,
-    0.99005818367004394531f,
-    0.99027281999588012695f,
-    0.99048507213592529297f,
-    0.99069499969482421875f,
-    0.99090266227722167969f,
-    0.99110794067382812500f,
-    0.99131083488464355469f,
-    0.99151146411895751953f,
-    0.99170976877212524414f,
-    0.99190568923950195312f,
-    0.99209928512573242188f,
-    0.99229061603546142578f,
-    0.99247956275939941406f,
-    0.99266612529754638672f,
-    0.99285042285919189453f,
-    0.99303233623504638672f,
-    0.99321192502975463867f,
-    0.99338918924331665039f,
-    0.99356412887573242188f,
-    0.99373674392700195312f,
-    0.99390697479248046875f,
-    0.99407488107681274414f,
-    0.99424046277999877930f,
-    0.99440366029739379883f,
-    0.99456459283828735352f,
-    0.99472314119338989258f,
-    0.99487930536270141602f,
-    0.99503320455551147461f,
-    0.99518471956253051758f,
-    0.99533390998840332031f,
-    0.99548077583312988281f,
-    0.99562525749206542969f,
-    0.99576741456985473633f,
-    0.99590724706649780273f,
-    0.99604469537734985352f,
-    0.99617981910705566406f,
-    0.99631261825561523438f,
-    0.99644303321838378906f,
-    0.99657112360000610352f,
-    0.99669688940048217773f,
-    0.99682027101516723633f,
-    0.99694132804870605469f,
-    0.99706006050109863281f,
-    0.99717640876770019531f,
-    0.99729043245315551758f,
-    0.99740213155746459961f,
-    0.99751144647598266602f,
-    0.99761843681335449219f,
-    0.99772304296493530273f,
-    0.99782532453536987305f,
-    0.99792528152465820312f,
-    0.99802285432815551758f,
-    0.99811810255050659180f,
-    0.99821102619171142578f,
-    0.99830156564712524414f,
-    0.99838972091674804688f,
-    0.99847555160522460938f,
-    0.99855905771255493164f,
-    0.99864023923873901367f,
-    0.99871903657913208008f,
-    0.99879544973373413086f,
-    0.99886953830718994141f,
-    0.99894130229949951172f,
-    0.99901068210601806641f,
-    0.99907773733139038086f,
-    0.99914240837097167969f,
-    0.99920475482940673828f,
-    0.99926477670669555664f,
-    0.99932235479354858398f,
-    0.99937766790390014648f,
-    0.99943059682846069336f,
-    0.99948120117187500000f,
-    0.99952942132949829102f,
-    0.99957531690597534180f,
-    0.99961882829666137695f,
-    0.99966001510620117188f,
-    0.99969881772994995117f,
-    0.99973529577255249023f,
-    0.99976938962936401367f,
-    0.99980115890502929688f,
-    0.99983060359954833984f,
-    0.99985766410827636719f,
-    0.99988234043121337891f,
-    0.99990469217300415039f,
-    0.99992471933364868164f,
-    0.99994236230850219727f,
-    0.99995762109756469727f,
-    0.99997061491012573242f,
-    0.99998116493225097656f,
-    0.99998939037322998047f,
-    0.99999529123306274414f,
-    0.99999880790710449219f,
-    1.00000000000000000000f,
-    0.99999880790710449219f,
-    0.99999529123306274414f,
-    0.99998939037322998047f,
-    0.99998116493225097656f,
-    0.99997061491012573242f,
-    0.99995762109756469727f,
-    0.99994236230850219727f,
-    0.99992471933364868164f,
-    0.99990469217300415039f,
-    0.99988234043121337891f,
-    0.99985766410827636719f,
-    0.99983060359954833984f,
-    0.99980115890502929688f,
-    0.99976938962936401367f,
-    0.99973529577255249023f,
-    0.99969881772994995117f,
-    0.99966001510620117188f,
-    0.99961882829666137695f,
-    0.99957531690597534180f,
-    0.99952942132949829102f,
-    0.99948120117187500000f,
-    0.99943059682846069336f,
-    0.99937766790390014648f,
-    0.99932235479354858398f,
-    0.99926477670669555664f,
-    0.99920475482940673828f,
-    0.99914240837097167969f,
-    0.99907773733139038086f,
-    0.99901068210601806641f,
-    0.99894130229949951172f,
-    0.99886953830718994141f,
-    0.99879544973373413086f,
-    0.99871903657913208008f,
-    0.99864023923873901367f,
-    0.99855905771255493164f,
-    0.99847555160522460938f,
-    0.99838972091674804688f,
-    0.99830156564712524414f,
-    0.99821102619171142578f,
-    0.99811810255050659180f,
-    0.99802285432815551758f,
-    0.99792528152465820312f,
-    0.99782532453536987305f,
-    0.99772304296493530273f,
-    0.99761843681335449219f,
-    0.99751144647598266602f,
-    0.99740213155746459961f,
-    0.99729043245315551758f,
-    0.99717640876770019531f,
-    0.99706006050109863281f,
-    0.99694132804870605469f,
-    0.99682027101516723633f,
-    0.99669688940048217773f,
-    0.99657112360000610352f,
-    0.99644303321838378906f,
-    0.99631261825561523438f,
-    0.99617981910705566406f,
-    0.99604469537734985352f,
-    0.99590724706649780273f,
-    0.99576741456985473633f,
-    0.99562525749206542969f,
-    0.99548077583312988281f,
-    0.99533390998840332031f,
-    0.99518471956253051758f,
-    0.99503320455551147461f,
-    0.99487930536270141602f,
-    0.99472314119338989258f,
-    0.99456459283828735352f,
-    0.99440366029739379883f,
-    0.99424046277999877930f,
-    0.99407488107681274414f,
-    0.99390697479248046875f,
-    0.99373674392700195312f,
-    0.99356412887573242188f,
-    0.99338918924331665039f,
-    0.99321192502975463867f,
-    0.99303233623504638672f,
-    0.99285042285919189453f,
-    0.99266612529754638672f,
-    0.99247956275939941406f,
-    0.99229061603546142578f,
-    0.99209928512573242188f,
-    0.99190568923950195312f,
-    0.99170976877212524414f,
-    0.99151146411895751953f,
-    0.99131083488464355469f,
-    0.99110794067382812500f,
-    0.99090266227722167969f,
-    0.99069499969482421875f,
-    0.99048507213592529297f,
-    0.99027281999588012695f,
-    0.99005818367004394531f,
-    0.98984128236770629883f,
-    0.98962199687957763672f,
-    0.98940044641494750977f,
-    0.98917651176452636719f,
-    0.98895025253295898438f,
-    0.98872166872024536133f,
-    0.98849081993103027344f,
-    0.98825758695602416992f,
-    0.98802202939987182617f,
-    0.98778414726257324219f,
-    0.98754394054412841797f,
-    0.98730140924453735352f,
-    0.98705655336380004883f,
-    0.98680937290191650391f,
-    0.98655992746353149414f,
-    0.98630809783935546875f,
-    0.98605394363403320312f,
-    0.98579752445220947266f,
-    0.98553872108459472656f,
-    0.98527765274047851562f,
-    0.98501425981521606445f,
-    0.98474848270416259766f,
-    0.98448044061660766602f,
-    0.98421007394790649414f,
-    0.98393744230270385742f,
-    0.98366242647171020508f,
-    0.98338508605957031250f,
-    0.98310548067092895508f,
-    0.98282355070114135742f,
-    0.98253929615020751953f,
-    0.98225271701812744141f,
-    0.98196387290954589844f,
-    0.98167270421981811523f,
-    0.98137921094894409180f,
-    0.98108339309692382812f,
-    0.98078525066375732422f,
-    0.98048484325408935547f,
-    0.98018211126327514648f,
-    0.97987711429595947266f,
-    0.97956979274749755859f,
-    0.97926014661788940430f,
-    0.97894817590713500977f,
-    0.97863394021987915039f,
-    0.97831737995147705078f,
-    0.97799849510192871094f,
-    0.97767734527587890625f,
-    0.97735387086868286133f,
-    0.97702813148498535156f,
-    0.97670006752014160156f,
-    0.97636973857879638672f,
-    0.97603708505630493164f,
-    0.97570210695266723633f,
-    0.97536486387252807617f,
-    0.97502535581588745117f,
-    0.97468352317810058594f,
-    0.97433936595916748047f,
-    0.97399294376373291016f,
-    0.97364425659179687500f,
-    0.97329324483871459961f,
-    0.97293996810913085938f,
-    0.97258436679840087891f,
-    0.97222650051116943359f,
-    0.97186630964279174805f,
-    0.97150391340255737305f,
-    0.97113913297653198242f,
-    0.97077214717864990234f,
-    0.97040283679962158203f,
-    0.97003126144409179688f,
-    0.96965736150741577148f,
-    0.96928125619888305664f,
-    0.96890282630920410156f,
-    0.96852207183837890625f,
-    0.96813911199569702148f,
-    0.96775382757186889648f,
-    0.96736627817153930664f,
-    0.96697646379470825195f,
-    0.96658438444137573242f,
-    0.96618998050689697266f,
-    0.96579337120056152344f,
-    0.96539443731307983398f,
-    0.96499323844909667969f,
-    0.96458977460861206055f,
-    0.96418404579162597656f,
-    0.96377605199813842773f,
-    0.96336579322814941406f,
-    0.96295326948165893555f,
-    0.96253848075866699219f,
-    0.96212142705917358398f,
-    0.96170204877853393555f,
-    0.96128046512603759766f,
-    0.96085661649703979492f,
-    0.96043050289154052734f,
-    0.96000212430953979492f,
-    0.95957154035568237305f,
-    0.95913863182067871094f,
-    0.95870345830917358398f,
-    0.95826607942581176758f,
-    0.95782643556594848633f,
-    0.95738452672958374023f,
-    0.95694035291671752930f,
-    0.95649391412734985352f,
-    0.95604526996612548828f,
-    0.95559436082839965820f,
-    0.95514118671417236328f,
-    0.95468574762344360352f,
-    0.95422810316085815430f,
-    0.95376819372177124023f,
-    0.95330601930618286133f,
-    0.95284163951873779297f,
-    0.95237499475479125977f,
-    0.95190614461898803711f,
-    0.95143502950668334961f,
-    0.95096164941787719727f,
-    0.95048606395721435547f,
-    0.95000827312469482422f,
-    0.94952815771102905273f,
-    0.94904589653015136719f,
-    0.94856137037277221680f,
-    0.94807457923889160156f,
-    0.94758558273315429688f,
-    0.94709438085556030273f,
-    0.94660091400146484375f,
-    0.94610524177551269531f,
-    0.94560730457305908203f,
-    0.94510722160339355469f,
-    0.94460481405258178711f,
-    0.94410026073455810547f,
-    0.94359344244003295898f,
-    0.94308441877365112305f,
-    0.94257318973541259766f,
-    0.94205975532531738281f,
-    0.94154405593872070312f,
-    0.94102615118026733398f,
-    0.94050604104995727539f,
-    0.93998372554779052734f,
-    0.93945920467376708984f,
-    0.93893247842788696289f,
-    0.93840354681015014648f,
-    0.93787235021591186523f,
-    0.93733900785446166992f,
-    0.93680346012115478516f,
-    0.93626564741134643555f,
-    0.93572568893432617188f,
-    0.93518352508544921875f,
-    0.93463915586471557617f,
-    0.93409252166748046875f,
-    0.93354380130767822266f,
-    0.93299281597137451172f,
-    0.93243962526321411133f,
-    0.93188428878784179688f,
-    0.93132668733596801758f,
-    0.93076694011688232422f,
-    0.93020504713058471680f,
-    0.92964088916778564453f,
-    0.92907458543777465820f,
-    0.92850607633590698242f,
-    0.92793542146682739258f,
-    0.92736250162124633789f,
-    0.92678749561309814453f,
-    0.92621022462844848633f,
-    0.92563080787658691406f,
-    0.92504924535751342773f,
-    0.92446547746658325195f,
-    0.92387950420379638672f,
-    0.92329144477844238281f,
-    0.92270112037658691406f,
-    0.92210865020751953125f,
-    0.92151403427124023438f,
-    0.92091721296310424805f,
-    0.92031830549240112305f,
-    0.91971713304519653320f,
-    0.91911387443542480469f,
-    0.91850841045379638672f,
-    0.91790080070495605469f,
-    0.91729098558425903320f,
-    0.91667908430099487305f,
-    0.91606497764587402344f,
-    0.91544872522354125977f,
-    0.91483032703399658203f,
-    0.91420978307723999023f,
-    0.91358703374862670898f,
-    0.91296219825744628906f,
-    0.91233515739440917969f,
-    0.91170603036880493164f,
-    0.91107475757598876953f,
-    0.91044127941131591797f,
-    0.90980571508407592773f,
-    0.90916800498962402344f,
-    0.90852808952331542969f,
-    0.90788608789443969727f,
-    0.90724200010299682617f,
-    0.90659570693969726562f,
-    0.90594726800918579102f,
-    0.90529674291610717773f,
-    0.90464407205581665039f,
-    0.90398931503295898438f,
-    0.90333235263824462891f,
-    0.90267330408096313477f,
-    0.90201216936111450195f,
-    0.90134882926940917969f,
-    0.90068340301513671875f,
-    0.90001589059829711914f,
-    0.89934623241424560547f,
-    0.89867448806762695312f,
-    0.89800059795379638672f,
-    0.89732456207275390625f,
-    0.89664649963378906250f,
-    0.89596623182296752930f,
-    0.89528393745422363281f,
-    0.89459949731826782227f,
-    0.89391297101974487305f,
-    0.89322429895401000977f,
-    0.89253354072570800781f,
-    0.89184069633483886719f,
-    0.89114576578140258789f,
-    0.89044874906539916992f,
-    0.88974958658218383789f,
-    0.88904833793640136719f,
-    0.88834506273269653320f,
-    0.88763964176177978516f,
-    0.88693213462829589844f,
-    0.88622254133224487305f,
-    0.88551086187362670898f,
-    0.88479709625244140625f,
-    0.88408124446868896484f,
-    0.88336336612701416016f,
-    0.88264334201812744141f,
-    0.88192129135131835938f,
-    0.88119709491729736328f,
-    0.88047087192535400391f,
-    0.87974262237548828125f,
-    0.87901222705841064453f,
-    0.87827980518341064453f,
-    0.87754529714584350586f,
-    0.87680870294570922852f,
-    0.87607008218765258789f,
-    0.87532937526702880859f,
-    0.87458664178848266602f,
-    0.87384182214736938477f,
-    0.87309497594833374023f,
-    0.87234604358673095703f,
-    0.87159508466720581055f,
-    0.87084203958511352539f,
-    0.87008696794509887695f,
-    0.86932986974716186523f,
-    0.86857068538665771484f,
-    0.86780947446823120117f,
-    0.86704623699188232422f,
-    0.86628097295761108398f,
-    0.86551362276077270508f,
-    0.86474424600601196289f,
-    0.86397284269332885742f,
-    0.86319941282272338867f,
-    0.86242395639419555664f,
-    0.86164647340774536133f,
-    0.86086696386337280273f,
-    0.86008536815643310547f,
-    0.85930180549621582031f,
-    0.85851621627807617188f,
-    0.85772860050201416016f,
-    0.85693895816802978516f,
-    0.85614734888076782227f,
-    0.85535365343093872070f,
-    0.85455799102783203125f,
-    0.85376030206680297852f,
-    0.85296058654785156250f,
-    0.85215890407562255859f,
-    0.85135519504547119141f,
-    0.85054945945739746094f,
-    0.84974175691604614258f,
-    0.84893202781677246094f,
-    0.84812033176422119141f,
-    0.84730660915374755859f,
-    0.84649091958999633789f,
-    0.84567326307296752930f,
-    0.84485357999801635742f,
-    0.84403187036514282227f,
-    0.84320825338363647461f,
-    0.84238260984420776367f,
-    0.84155499935150146484f,
-    0.84072536230087280273f,
-    0.83989381790161132812f,
-    0.83906024694442749023f,
-    0.83822470903396606445f,
-    0.83738720417022705078f,
-    0.83654773235321044922f,
-    0.83570629358291625977f,
-    0.83486288785934448242f,
-    0.83401751518249511719f,
-    0.83317017555236816406f,
-    0.83232086896896362305f,
-    0.83146959543228149414f,
-    0.83061641454696655273f,
-    0.82976120710372924805f,
-    0.82890409231185913086f,
-    0.82804507017135620117f,
-    0.82718402147293090820f,
-    0.82632106542587280273f,
-    0.82545614242553710938f,
-    0.82458931207656860352f,
-    0.82372051477432250977f,
-    0.82284981012344360352f,
-    0.82197713851928710938f,
-    0.82110249996185302734f,
-    0.82022595405578613281f,
-    0.81934750080108642578f,
-    0.81846714019775390625f,
-    0.81758481264114379883f,
-    0.81670057773590087891f,
-    0.81581443548202514648f,
-    0.81492632627487182617f,
-    0.81403630971908569336f,
-    0.81314438581466674805f,
-    0.81225061416625976562f,
-    0.81135487556457519531f,
-    0.81045717000961303711f,
-    0.80955761671066284180f,
-    0.80865615606307983398f,
-    0.80775284767150878906f,
-    0.80684757232666015625f,
-    0.80594038963317871094f,
-    0.80503135919570922852f,
-    0.80412036180496215820f,
-    0.80320751667022705078f,
-    0.80229282379150390625f,
-    0.80137616395950317383f,
-    0.80045765638351440430f,
-    0.79953724145889282227f,
-    0.79861497879028320312f,
-    0.79769086837768554688f,
-    0.79676479101181030273f,
-    0.79583692550659179688f,
-    0.79490715265274047852f,
-    0.79397547245025634766f,
-    0.79304194450378417969f,
-    0.79210656881332397461f,
-    0.79116934537887573242f,
-    0.79023021459579467773f,
-    0.78928923606872558594f,
-    0.78834640979766845703f,
-    0.78740173578262329102f,
-    0.78645521402359008789f,
-    0.78550684452056884766f,
-    0.78455656766891479492f,
-    0.78360450267791748047f,
-    0.78265058994293212891f,
-    0.78169482946395874023f,
-    0.78073722124099731445f,
-    0.77977776527404785156f,
-    0.77881652116775512695f,
-    0.77785342931747436523f,
-    0.77688848972320556641f,
-    0.77592170238494873047f,
-    0.77495312690734863281f,
-    0.77398270368576049805f,
-    0.77301043272018432617f,
-    0.77203637361526489258f,
-    0.77106052637100219727f,
-    0.77008283138275146484f,
-    0.76910334825515747070f,
-    0.76812201738357543945f,
-    0.76713889837265014648f,
-    0.76615399122238159180f,
-    0.76516723632812500000f,
-    0.76417875289916992188f,
-    0.76318842172622680664f,
-    0.76219630241394042969f,
-    0.76120239496231079102f,
-    0.76020669937133789062f,
-    0.75920921564102172852f,
-    0.75820988416671752930f,
-    0.75720882415771484375f,
-    0.75620597600936889648f,
-    0.75520139932632446289f,
-    0.75419497489929199219f,
-    0.75318682193756103516f,
-    0.75217682123184204102f,
-    0.75116515159606933594f,
-    0.75015163421630859375f,
-    0.74913638830184936523f,
-    0.74811935424804687500f,
-    0.74710059165954589844f,
-    0.74608010053634643555f,
-    0.74505776166915893555f,
-    0.74403375387191772461f,
-    0.74300795793533325195f,
-    0.74198043346405029297f,
-    0.74095112085342407227f,
-    0.73992007970809936523f,
-    0.73888731002807617188f,
-    0.73785281181335449219f,
-    0.73681658506393432617f,
-    0.73577857017517089844f,
-    0.73473888635635375977f,
-    0.73369741439819335938f,
-    0.73265427350997924805f,
-    0.73160940408706665039f,
-    0.73056274652481079102f,
-    0.72951442003250122070f,
-    0.72846436500549316406f,
-    0.72741264104843139648f,
-    0.72635912895202636719f,
-    0.72530394792556762695f,
-    0.72424709796905517578f,
-    0.72318845987319946289f,
-    0.72212821245193481445f,
-    0.72106617689132690430f,
-    0.72000253200531005859f,
-    0.71893709897994995117f,
-    0.71787005662918090820f,
-    0.71680128574371337891f,
-    0.71573084592819213867f,
-    0.71465867757797241211f,
-    0.71358484029769897461f,
-    0.71250939369201660156f,
-    0.71143221855163574219f,
-    0.71035337448120117188f,
-    0.70927280187606811523f,
-    0.70819061994552612305f,
-    0.70710676908493041992f,
-    0.70602124929428100586f,
-    0.70493406057357788086f,
-    0.70384526252746582031f,
-    0.70275473594665527344f,
-    0.70166260004043579102f,
-    0.70056879520416259766f,
-    0.69947332143783569336f,
-    0.69837623834609985352f,
-    0.69727748632431030273f,
-    0.69617712497711181641f,
-    0.69507509469985961914f,
-    0.69397145509719848633f,
-    0.69286614656448364258f,
-    0.69175922870635986328f,
-    0.69065070152282714844f,
-    0.68954056501388549805f,
-    0.68842875957489013672f,
-    0.68731534481048583984f,
-    0.68620032072067260742f,
-    0.68508368730545043945f,
-    0.68396538496017456055f,
-    0.68284553289413452148f,
-    0.68172407150268554688f,
-    0.68060100078582763672f,
-    0.67947632074356079102f,
-    0.67835003137588500977f,
-    0.67722219228744506836f,
-    0.67609268426895141602f,
-    0.67496162652969360352f,
-    0.67382901906967163086f,
-    0.67269474267959594727f,
-    0.67155897617340087891f,
-    0.67042154073715209961f,
-    0.66928261518478393555f,
-    0.66814202070236206055f,
-    0.66699993610382080078f,
-    0.66585624217987060547f,
-    0.66471099853515625000f,
-    0.66356414556503295898f,
-    0.66241580247879028320f,
-    0.66126585006713867188f,
-    0.66011434793472290039f,
-    0.65896129608154296875f,
-    0.65780669450759887695f,
-    0.65665054321289062500f,
-    0.65549284219741821289f,
-    0.65433359146118164062f,
-    0.65317285060882568359f,
-    0.65201056003570556641f,
-    0.65084666013717651367f,
-    0.64968132972717285156f,
-    0.64851438999176025391f,
-    0.64734596014022827148f,
-    0.64617604017257690430f,
-    0.64500451087951660156f,
-    0.64383155107498168945f,
-    0.64265704154968261719f,
-    0.64148104190826416016f,
-    0.64030349254608154297f,
-    0.63912445306777954102f,
-    0.63794392347335815430f,
-    0.63676184415817260742f,
-    0.63557833433151245117f,
-    0.63439327478408813477f,
-    0.63320678472518920898f,
-    0.63201874494552612305f,
-    0.63082921504974365234f,
-    0.62963825464248657227f,
-    0.62844574451446533203f,
-    0.62725180387496948242f,
-    0.62605637311935424805f,
-    0.62485951185226440430f,
-    0.62366110086441040039f,
-    0.62246125936508178711f,
-    0.62125998735427856445f,
-    0.62005722522735595703f,
-    0.61885297298431396484f,
-    0.61764729022979736328f,
-    0.61644017696380615234f,
-    0.61523157358169555664f,
-    0.61402153968811035156f,
-    0.61281007528305053711f,
-    0.61159718036651611328f,
-    0.61038279533386230469f,
-    0.60916703939437866211f,
-    0.60794979333877563477f,
-    0.60673111677169799805f,
-    0.60551106929779052734f,
-    0.60428953170776367188f,
-    0.60306662321090698242f,
-    0.60184222459793090820f,
-    0.60061645507812500000f,
-    0.59938931465148925781f,
-    0.59816068410873413086f,
-    0.59693068265914916992f,
-    0.59569931030273437500f,
-    0.59446650743484497070f,
-    0.59323227405548095703f,
-    0.59199666976928710938f,
-    0.59075969457626342773f,
-    0.58952128887176513672f,
-    0.58828157186508178711f,
-    0.58704036474227905273f,
-    0.58579784631729125977f,
-    0.58455395698547363281f,
-    0.58330863714218139648f,
-    0.58206200599670410156f,
-    0.58081394433975219727f,
-    0.57956457138061523438f,
-    0.57831376791000366211f,
-    0.57706165313720703125f,
-    0.57580816745758056641f,
-    0.57455337047576904297f,
-    0.57329714298248291016f,
-    0.57203960418701171875f,
-    0.57078075408935546875f,
-    0.56952053308486938477f,
-    0.56825894117355346680f,
-    0.56699603796005249023f,
-    0.56573182344436645508f,
-    0.56446623802185058594f,
-    0.56319934129714965820f,
-    0.56193113327026367188f,
-    0.56066155433654785156f,
-    0.55939072370529174805f,
-    0.55811852216720581055f,
-    0.55684500932693481445f,
-    0.55557024478912353516f,
-    0.55429410934448242188f,
-    0.55301672220230102539f,
-    0.55173796415328979492f,
-    0.55045795440673828125f,
-    0.54917663335800170898f,
-    0.54789406061172485352f,
-    0.54661017656326293945f,
-    0.54532498121261596680f,
-    0.54403853416442871094f,
-    0.54275077581405639648f,
-    0.54146176576614379883f,
-    0.54017144441604614258f,
-    0.53887993097305297852f,
-    0.53758704662322998047f,
-    0.53629297018051147461f,
-    0.53499764204025268555f,
-    0.53370100259780883789f,
-    0.53240311145782470703f,
-    0.53110402822494506836f,
-    0.52980363368988037109f,
-    0.52850198745727539062f,
-    0.52719914913177490234f,
-    0.52589499950408935547f,
-    0.52458965778350830078f,
-    0.52328312397003173828f,
-    0.52197527885437011719f,
-    0.52066624164581298828f,
-    0.51935601234436035156f,
-    0.51804453134536743164f,
-    0.51673179864883422852f,
-    0.51541787385940551758f,
-    0.51410275697708129883f,
-    0.51278638839721679688f,
-    0.51146882772445678711f,
-    0.51015007495880126953f,
-    0.50883013010025024414f,
-    0.50750899314880371094f,
-    0.50618666410446166992f,
-    0.50486308336257934570f,
-    0.50353837013244628906f,
-    0.50221246480941772461f,
-    0.50088536739349365234f,
-    0.49955710768699645996f,
-    0.49822765588760375977f,
-    0.49689704179763793945f,
-    0.49556526541709899902f,
-    0.49423229694366455078f,
-    0.49289819598197937012f,
-    0.49156290292739868164f,
-    0.49022647738456726074f,
-    0.48888888955116271973f,
-    0.48755016922950744629f,
-    0.48621028661727905273f,
-    0.48486924171447753906f,
-    0.48352706432342529297f,
-    0.48218378424644470215f,
-    0.48083934187889099121f,
-    0.47949376702308654785f,
-    0.47814705967903137207f,
-    0.47679921984672546387f,
-    0.47545027732849121094f,
-    0.47410020232200622559f,
-    0.47274902462959289551f,
-    0.47139674425125122070f,
-    0.47004333138465881348f,
-    0.46868881583213806152f,
-    0.46733319759368896484f,
-    0.46597650647163391113f,
-    0.46461868286132812500f,
-    0.46325978636741638184f,
-    0.46189978718757629395f,
-    0.46053871512413024902f,
-    0.45917654037475585938f,
-    0.45781329274177551270f,
-    0.45644897222518920898f,
-    0.45508357882499694824f,
-    0.45371711254119873047f,
-    0.45234957337379455566f,
-    0.45098099112510681152f,
-    0.44961133599281311035f,
-    0.44824060797691345215f,
-    0.44686883687973022461f,
-    0.44549602270126342773f,
-    0.44412213563919067383f,
-    0.44274723529815673828f,
-    0.44137126207351684570f,
-    0.43999427556991577148f,
-    0.43861624598503112793f,
-    0.43723717331886291504f,
-    0.43585708737373352051f,
-    0.43447595834732055664f,
-    0.43309381604194641113f,
-    0.43171066045761108398f,
-    0.43032649159431457520f,
-    0.42894127964973449707f,
-    0.42755508422851562500f,
-    0.42616787552833557129f,
-    0.42477968335151672363f,
-    0.42339047789573669434f,
-    0.42200025916099548340f,
-    0.42060908675193786621f,
-    0.41921690106391906738f,
-    0.41782370209693908691f,
-    0.41642954945564270020f,
-    0.41503441333770751953f,
-    0.41363832354545593262f,
-    0.41224122047424316406f,
-    0.41084316372871398926f,
-    0.40944415330886840820f,
-    0.40804415941238403320f,
-    0.40664321184158325195f,
-    0.40524131059646606445f,
-    0.40383845567703247070f,
-    0.40243464708328247070f,
-    0.40102988481521606445f,
-    0.39962419867515563965f,
-    0.39821755886077880859f,
-    0.39680999517440795898f,
-    0.39540147781372070312f,
-    0.39399203658103942871f,
-    0.39258167147636413574f,
-    0.39117038249969482422f,
-    0.38975816965103149414f,
-    0.38834503293037414551f,
-    0.38693100214004516602f,
-    0.38551604747772216797f,
-    0.38410019874572753906f,
-    0.38268342614173889160f,
-    0.38126575946807861328f,
-    0.37984719872474670410f,
-    0.37842774391174316406f,
-    0.37700742483139038086f,
-    0.37558618187904357910f,
-    0.37416407465934753418f,
-    0.37274107336997985840f,
-    0.37131720781326293945f,
-    0.36989244818687438965f,
-    0.36846682429313659668f,
-    0.36704033613204956055f,
-    0.36561298370361328125f,
-    0.36418479681015014648f,
-    0.36275571584701538086f,
-    0.36132580041885375977f,
-    0.35989505052566528320f,
-    0.35846340656280517578f,
-    0.35703095793724060059f,
-    0.35559767484664916992f,
-    0.35416352748870849609f,
-    0.35272854566574096680f,
-    0.35129275918006896973f,
-    0.34985613822937011719f,
-    0.34841868281364440918f,
-    0.34698042273521423340f,
-    0.34554132819175720215f,
-    0.34410142898559570312f,
-    0.34266072511672973633f,
-    0.34121921658515930176f,
-    0.33977687358856201172f,
-    0.33833375573158264160f,
-    0.33688986301422119141f,
-    0.33544513583183288574f,
-    0.33399966359138488770f,
-    0.33255335688591003418f,
-    0.33110630512237548828f,
-    0.32965844869613647461f,
-    0.32820984721183776855f,
-    0.32676044106483459473f,
-    0.32531028985977172852f,
-    0.32385936379432678223f,
-    0.32240769267082214355f,
-    0.32095524668693542480f,
-    0.31950202584266662598f,
-    0.31804808974266052246f,
-    0.31659337878227233887f,
-    0.31513792276382446289f,
-    0.31368175148963928223f,
-    0.31222480535507202148f,
-    0.31076714396476745605f,
-    0.30930876731872558594f,
-    0.30784964561462402344f,
-    0.30638980865478515625f,
-    0.30492922663688659668f,
-    0.30346795916557312012f,
-    0.30200594663619995117f,
-    0.30054324865341186523f,
-    0.29907983541488647461f,
-    0.29761570692062377930f,
-    0.29615089297294616699f,
-    0.29468536376953125000f,
-    0.29321914911270141602f,
-    0.29175224900245666504f,
-    0.29028466343879699707f,
-    0.28881642222404479980f,
-    0.28734746575355529785f,
-    0.28587782382965087891f,
-    0.28440752625465393066f,
-    0.28293657302856445312f,
-    0.28146493434906005859f,
-    0.27999264001846313477f,
-    0.27851969003677368164f,
-    0.27704608440399169922f,
-    0.27557182312011718750f,
-    0.27409690618515014648f,
-    0.27262136340141296387f,
-    0.27114516496658325195f,
-    0.26966831088066101074f,
-    0.26819086074829101562f,
-    0.26671275496482849121f,
-    0.26523402333259582520f,
-    0.26375466585159301758f,
-    0.26227471232414245605f,
-    0.26079410314559936523f,
-    0.25931292772293090820f,
-    0.25783109664916992188f,
-    0.25634866952896118164f,
-    0.25486564636230468750f,
-    0.25338202714920043945f,
-    0.25189781188964843750f,
-    0.25041300058364868164f,
-    0.24892760813236236572f,
-    0.24744161963462829590f,
-    0.24595504999160766602f,
-    0.24446789920330047607f,
-    0.24298018217086791992f,
-    0.24149188399314880371f,
-    0.24000301957130432129f,
-    0.23851358890533447266f,
-    0.23702360689640045166f,
-    0.23553305864334106445f,
-    0.23404195904731750488f,
-    0.23255030810832977295f,
-    0.23105810582637786865f,
-    0.22956536710262298584f,
-    0.22807207703590393066f,
-    0.22657826542854309082f,
-    0.22508391737937927246f,
-    0.22358903288841247559f,
-    0.22209362685680389404f,
-    0.22059768438339233398f,
-    0.21910123527050018311f,
-    0.21760427951812744141f,
-    0.21610680222511291504f,
-    0.21460881829261779785f,
-    0.21311031281948089600f,
-    0.21161133050918579102f,
-    0.21011184155941009521f,
-    0.20861184597015380859f,
-    0.20711137354373931885f,
-    0.20561040937900543213f,
-    0.20410896837711334229f,
-    0.20260703563690185547f,
-    0.20110464096069335938f,
-    0.19960175454616546631f,
-    0.19809840619564056396f,
-    0.19659459590911865234f,
-    0.19509032368659973145f,
-    0.19358558952808380127f,
-    0.19208039343357086182f,
-    0.19057475030422210693f,
-    0.18906866014003753662f,
-    0.18756212294101715088f,
-    0.18605515360832214355f,
-    0.18454773724079132080f,
-    0.18303988873958587646f,
-    0.18153160810470581055f,
-    0.18002289533615112305f,
-    0.17851376533508300781f,
-    0.17700421810150146484f,
-    0.17549425363540649414f,
-    0.17398387193679809570f,
-    0.17247308790683746338f,
-    0.17096188664436340332f,
-    0.16945029795169830322f,
-    0.16793829202651977539f,
-    0.16642589867115020752f,
-    0.16491311788558959961f,
-    0.16339994966983795166f,
-    0.16188639402389526367f,
-    0.16037245094776153564f,
-    0.15885815024375915527f,
-    0.15734346210956573486f,
-    0.15582840144634246826f,
-    0.15431296825408935547f,
-    0.15279719233512878418f,
-    0.15128104388713836670f,
-    0.14976453781127929688f,
-    0.14824767410755157471f,
-    0.14673046767711639404f,
-    0.14521291851997375488f,
-    0.14369502663612365723f,
-    0.14217680692672729492f,
-    0.14065824449062347412f,
-    0.13913933932781219482f,
-    0.13762012124061584473f,
-    0.13610057532787322998f,
-    0.13458070158958435059f,
-    0.13306052982807159424f,
-    0.13154003024101257324f,
-    0.13001921772956848145f,
-    0.12849810719490051270f,
-    0.12697669863700866699f,
-    0.12545497715473175049f,
-    0.12393297255039215088f,
-    0.12241067737340927124f,
-    0.12088808417320251465f,
-    0.11936521530151367188f,
-    0.11784206330776214600f,
-    0.11631862819194793701f,
-    0.11479492485523223877f,
-    0.11327095329761505127f,
-    0.11174671351909637451f,
-    0.11022220551967620850f,
-    0.10869744420051574707f,
-    0.10717242211103439331f,
-    0.10564715415239334106f,
-    0.10412163287401199341f,
-    0.10259586572647094727f,
-    0.10106986016035079956f,
-    0.09954361617565155029f,
-    0.09801714122295379639f,
-    0.09649042785167694092f,
-    0.09496349841356277466f,
-    0.09343633800745010376f,
-    0.09190895408391952515f,
-    0.09038136154413223267f,
-    0.08885355293750762939f,
-    0.08732553571462631226f,
-    0.08579730987548828125f,
-    0.08426889032125473022f,
-    0.08274026215076446533f,
-    0.08121144771575927734f,
-    0.07968243956565856934f,
-    0.07815324515104293823f,
-    0.07662386447191238403f,
-    0.07509429752826690674f,
-    0.07356456667184829712f,
-    0.07203464955091476440f,
-    0.07050457596778869629f,
-    0.06897433102130889893f,
-    0.06744392216205596924f,
-    0.06591334939002990723f,
-    0.06438262760639190674f,
-    0.06285175681114196777f,
-    0.06132073700428009033f,
-    0.05978957191109657288f,
-    0.05825826525688171387f,
-    0.05672682076692581177f,
-    0.05519524589180946350f,
-    0.05366353690624237061f,
-    0.05213170498609542847f,
-    0.05059975013136863708f,
-    0.04906767606735229492f,
-    0.04753548279404640198f,
-    0.04600318148732185364f,
-    0.04447077214717864990f,
-    0.04293825849890708923f,
-    0.04140564054250717163f,
-    0.03987292572855949402f,
-    0.03834012150764465332f,
-    0.03680722415447235107f,
-    0.03527423739433288574f,
-    0.03374117240309715271f,
-    0.03220802545547485352f,
-    0.03067480400204658508f,
-    0.02914150804281234741f,
-    0.02760814502835273743f,
-    0.02607471868395805359f,
-    0.02454122900962829590f,
-    0.02300768159329891205f,
-    0.02147408016026020050f,
-    0.01994042843580245972f,
-    0.01840673014521598816f,
-    0.01687298715114593506f,
-    0.01533920597285032272f,
-    0.01380538847297430038f,
-    0.01227153837680816650f,
-    0.01073765940964221954f,
-    0.00920375436544418335f,
-    0.00766982883214950562f,
-    0.00613588467240333557f,
-    0.00460192607715725899f,
-    0.00306795677170157433f,
-    0.00153398013208061457f,
-    0.00000000000000000000f,
-    -0.00153398013208061457f,
-    -0.00306795677170157433f,
-    -0.00460192607715725899f,
-    -0.00613588467240333557f,
-    -0.00766982883214950562f,
-    -0.00920375436544418335f,
-    -0.01073765940964221954f,
-    -0.01227153837680816650f,
-    -0.01380538847297430038f,
-    -0.01533920597285032272f,
-    -0.01687298715114593506f,
-    -0.01840673014521598816f,
-    -0.01994042843580245972f,
-    -0.02147408016026020050f,
-    -0.02300768159329891205f,
-    -0.02454122900962829590f,
-    -0.02607471868395805359f,
-    -0.02760814502835273743f,
-    -0.02914150804281234741f,
-    -0.03067480400204658508f,
-    -0.03220802545547485352f,
-    -0.03374117240309715271f,
-    -0.03527423739433288574f,
-    -0.03680722415447235107f,
-    -0.03834012150764465332f,
-    -0.03987292572855949402f,
-    -0.04140564054250717163f,
-    -0.04293825849890708923f,
-    -0.04447077214717864990f,
-    -0.04600318148732185364f,
-    -0.04753548279404640198f,
-    -0.04906767606735229492f,
-    -0.05059975013136863708f,
-    -0.05213170498609542847f,
-    -0.05366353690624237061f,
-    -0.05519524589180946350f,
-    -0.05672682076692581177f,
-    -0.05825826525688171387f,
-    -0.05978957191109657288f,
-    -0.06132073700428009033f,
-    -0.06285175681114196777f,
-    -0.06438262760639190674f,
-    -0.06591334939002990723f,
-    -0.06744392216205596924f,
-    -0.06897433102130889893f,
-    -0.07050457596778869629f,
-    -0.07203464955091476440f,
-    -0.07356456667184829712f,
-    -0.07509429752826690674f,
-    -0.07662386447191238403f,
-    -0.07815324515104293823f,
-    -0.07968243956565856934f,
-    -0.08121144771575927734f,
-    -0.08274026215076446533f,
-    -0.08426889032125473022f,
-    -0.08579730987548828125f,
-    -0.08732553571462631226f,
-    -0.08885355293750762939f,
-    -0.09038136154413223267f,
-    -0.09190895408391952515f,
-    -0.09343633800745010376f,
-    -0.09496349841356277466f,
-    -0.09649042785167694092f,
-    -0.09801714122295379639f,
-    -0.09954361617565155029f,
-    -0.10106986016035079956f,
-    -0.10259586572647094727f,
-    -0.10412163287401199341f,
-    -0.10564715415239334106f,
-    -0.10717242211103439331f,
-    -0.10869744420051574707f,
-    -0.11022220551967620850f,
-    -0.11174671351909637451f,
-    -0.11327095329761505127f,
-    -0.11479492485523223877f,
-    -0.11631862819194793701f,
-    -0.11784206330776214600f,
-    -0.11936521530151367188f,
-    -0.12088808417320251465f,
-    -0.12241067737340927124f,
-    -0.12393297255039215088f,
-    -0.12545497715473175049f,
-    -0.12697669863700866699f,
-    -0.12849810719490051270f,
-    -0.13001921772956848145f,
-    -0.13154003024101257324f,
-    -0.13306052982807159424f,
-    -0.13458070158958435059f,
-    -0.13610057532787322998f,
-    -0.13762012124061584473f,
-    -0.13913933932781219482f,
-    -0.14065824449062347412f,
-    -0.14217680692672729492f,
-    -0.14369502663612365723f,
-    -0.14521291851997375488f,
-    -0.14673046767711639404f,
-    -0.14824767410755157471f,
-    -0.14976453781127929688f,
-    -0.15128104388713836670f,
-    -0.15279719233512878418f,
-    -0.15431296825408935547f,
-    -0.15582840144634246826f,
-    -0.15734346210956573486f,
-    -0.15885815024375915527f,
-    -0.16037245094776153564f,
-    -0.16188639402389526367f,
-    -0.16339994966983795166f,
-    -0.16491311788558959961f,
-    -0.16642589867115020752f,
-    -0.16793829202651977539f,
-    -0.16945029795169830322f,
-    -0.17096188664436340332f,
-    -0.17247308790683746338f,
-    -0.17398387193679809570f,
-    -0.17549425363540649414f,
-    -0.17700421810150146484f,
-    -0.17851376533508300781f,
-    -0.18002289533615112305f,
-    -0.18153160810470581055f,
-    -0.18303988873958587646f,
-    -0.18454773724079132080f,
-    -0.18605515360832214355f,
-    -0.18756212294101715088f,
-    -0.18906866014003753662f,
-    -0.19057475030422210693f,
-    -0.19208039343357086182f,
-    -0.19358558952808380127f,
-    -0.19509032368659973145f,
-    -0.19659459590911865234f,
-    -0.19809840619564056396f,
-    -0.19960175454616546631f,
-    -0.20110464096069335938f,
-    -0.20260703563690185547f,
-    -0.20410896837711334229f,
-    -0.20561040937900543213f,
-    -0.20711137354373931885f,
-    -0.20861184597015380859f,
-    -0.21011184155941009521f,
-    -0.21161133050918579102f,
-    -0.21311031281948089600f,
-    -0.21460881829261779785f,
-    -0.21610680222511291504f,
-    -0.21760427951812744141f,
-    -0.21910123527050018311f,
-    -0.22059768438339233398f,
-    -0.22209362685680389404f,
-    -0.22358903288841247559f,
-    -0.22508391737937927246f,
-    -0.22657826542854309082f,
-    -0.22807207703590393066f,
-    -0.22956536710262298584f,
-    -0.23105810582637786865f,
-    -0.23255030810832977295f,
-    -0.23404195904731750488f,
-    -0.23553305864334106445f,
-    -0.23702360689640045166f,
-    -0.23851358890533447266f,
-    -0.24000301957130432129f,
-    -0.24149188399314880371f,
-    -0.24298018217086791992f,
-    -0.24446789920330047607f,
-    -0.24595504999160766602f,
-    -0.24744161963462829590f,
-    -0.24892760813236236572f,
-    -0.25041300058364868164f,
-    -0.25189781188964843750f,
-    -0.25338202714920043945f,
-    -0.25486564636230468750f,
-    -0.25634866952896118164f,
-    -0.25783109664916992188f,
-    -0.25931292772293090820f,
-    -0.26079410314559936523f,
-    -0.26227471232414245605f,
-    -0.26375466585159301758f,
-    -0.26523402333259582520f,
-    -0.26671275496482849121f,
-    -0.26819086074829101562f,
-    -0.26966831088066101074f,
-    -0.27114516496658325195f,
-    -0.27262136340141296387f,
-    -0.27409690618515014648f,
-    -0.27557182312011718750f,
-    -0.27704608440399169922f,
-    -0.27851969003677368164f,
-    -0.27999264001846313477f,
-    -0.28146493434906005859f,
-    -0.28293657302856445312f,
-    -0.28440752625465393066f,
-    -0.28587782382965087891f,
-    -0.28734746575355529785f,
-    -0.28881642222404479980f,
-    -0.29028466343879699707f,
-    -0.29175224900245666504f,
-    -0.29321914911270141602f,
-    -0.29468536376953125000f,
-    -0.29615089297294616699f,
-    -0.29761570692062377930f,
-    -0.29907983541488647461f,
-    -0.30054324865341186523f,
-    -0.30200594663619995117f,
-    -0.30346795916557312012f,
-    -0.30492922663688659668f,
-    -0.30638980865478515625f,
-    -0.30784964561462402344f,
-    -0.30930876731872558594f,
-    -0.31076714396476745605f,
-    -0.31222480535507202148f,
-    -0.31368175148963928223f,
-    -0.31513792276382446289f,
-    -0.31659337878227233887f,
-    -0.31804808974266052246f,
-    -0.31950202584266662598f,
-    -0.32095524668693542480f,
-    -0.32240769267082214355f,
-    -0.32385936379432678223f,
-    -0.32531028985977172852f,
-    -0.32676044106483459473f,
-    -0.32820984721183776855f,
-    -0.32965844869613647461f,
-    -0.33110630512237548828f,
-    -0.33255335688591003418f,
-    -0.33399966359138488770f,
-    -0.33544513583183288574f,
-    -0.33688986301422119141f,
-    -0.33833375573158264160f,
-    -0.33977687358856201172f,
-    -0.34121921658515930176f,
-    -0.34266072511672973633f,
-    -0.34410142898559570312f,
-    -0.34554132819175720215f,
-    -0.34698042273521423340f,
-    -0.34841868281364440918f,
-    -0.34985613822937011719f,
-    -0.35129275918006896973f,
-    -0.35272854566574096680f,
-    -0.35416352748870849609f,
-    -0.35559767484664916992f,
-    -0.35703095793724060059f,
-    -0.35846340656280517578f,
-    -0.35989505052566528320f,
-    -0.36132580041885375977f,
-    -0.36275571584701538086f,
-    -0.36418479681015014648f,
-    -0.36561298370361328125f,
-    -0.36704033613204956055f,
-    -0.36846682429313659668f,
-    -0.36989244818687438965f,
-    -0.37131720781326293945f,
-    -0.37274107336997985840f,
-    -0.37416407465934753418f,
-    -0.37558618187904357910f,
-    -0.37700742483139038086f,
-    -0.37842774391174316406f,
-    -0.37984719872474670410f,
-    -0.38126575946807861328f,
-    -0.38268342614173889160f,
-    -0.38410019874572753906f,
-    -0.38551604747772216797f,
-    -0.38693100214004516602f,
-    -0.38834503293037414551f,
-    -0.38975816965103149414f,
-    -0.39117038249969482422f,
-    -0.39258167147636413574f,
-    -0.39399203658103942871f,
-    -0.39540147781372070312f,
-    -0.39680999517440795898f,
-    -0.39821755886077880859f,
-    -0.39962419867515563965f,
-    -0.40102988481521606445f,
-    -0.40243464708328247070f,
-    -0.40383845567703247070f,
-    -0.40524131059646606445f,
-    -0.40664321184158325195f,
-    -0.40804415941238403320f,
-    -0.40944415330886840820f,
-    -0.41084316372871398926f,
-    -0.41224122047424316406f,
-    -0.41363832354545593262f,
-    -0.41503441333770751953f,
-    -0.41642954945564270020f,
-    -0.41782370209693908691f,
-    -0.41921690106391906738f,
-    -0.42060908675193786621f,
-    -0.42200025916099548340f,
-    -0.42339047789573669434f,
-    -0.42477968335151672363f,
-    -0.42616787552833557129f,
-    -0.42755508422851562500f,
-    -0.42894127964973449707f,
-    -0.43032649159431457520f,
-    -0.43171066045761108398f,
-    -0.43309381604194641113f,
-    -0.43447595834732055664f,
-    -0.43585708737373352051f,
-    -0.43723717331886291504f,
-    -0.43861624598503112793f,
-    -0.43999427556991577148f,
-    -0.44137126207351684570f,
-    -0.44274723529815673828f,
-    -0.44412213563919067383f,
-    -0.44549602270126342773f,
-    -0.44686883687973022461f,
-    -0.44824060797691345215f,
-    -0.44961133599281311035f,
-    -0.45098099112510681152f,
-    -0.45234957337379455566f,
-    -0.45371711254119873047f,
-    -0.45508357882499694824f,
-    -0.45644897222518920898f,
-    -0.45781329274177551270f,
-    -0.45917654037475585938f,
-    -0.46053871512413024902f,
-    -0.46189978718757629395f,
-    -0.46325978636741638184f,
-    -0.46461868286132812500f,
-    -0.46597650647163391113f,
-    -0.46733319759368896484f,
-    -0.46868881583213806152f,
-    -0.47004333138465881348f,
-    -0.47139674425125122070f,
-    -0.47274902462959289551f,
-    -0.47410020232200622559f,
-    -0.47545027732849121094f,
-    -0.47679921984672546387f,
-    -0.47814705967903137207f,
-    -0.47949376702308654785f,
-    -0.48083934187889099121f,
-    -0.48218378424644470215f,
-    -0.48352706432342529297f,
-    -0.48486924171447753906f,
-    -0.48621028661727905273f,
-    -0.48755016922950744629f,
-    -0.48888888955116271973f,
-    -0.49022647738456726074f,
-    -0.49156290292739868164f,
-    -0.49289819598197937012f,
-    -0.49423229694366455078f,
-    -0.49556526541709899902f,
-    -0.49689704179763793945f,
-    -0.49822765588760375977f,
-    -0.49955710768699645996f,
-    -0.50088536739349365234f,
-    -0.50221246480941772461f,
-    -0.50353837013244628906f,
-    -0.50486308336257934570f,
-    -0.50618666410446166992f,
-    -0.50750899314880371094f,
-    -0.50883013010025024414f,
-    -0.51015007495880126953f,
-    -0.51146882772445678711f,
-    -0.51278638839721679688f,
-    -0.51410275697708129883f,
-    -0.51541787385940551758f,
-    -0.51673179864883422852f,
-    -0.51804453134536743164f,
-    -0.51935601234436035156f,
-    -0.52066624164581298828f,
-    -0.52197527885437011719f,
-    -0.52328312397003173828f,
-    -0.52458965778350830078f,
-    -0.52589499950408935547f,
-    -0.52719914913177490234f,
-    -0.52850198745727539062f,
-    -0.52980363368988037109f,
-    -0.53110402822494506836f,
-    -0.53240311145782470703f,
-    -0.53370100259780883789f,
-    -0.53499764204025268555f,
-    -0.53629297018051147461f,
-    -0.53758704662322998047f,
-    -0.53887993097305297852f,
-    -0.54017144441604614258f,
-    -0.54146176576614379883f,
-    -0.54275077581405639648f,
-    -0.54403853416442871094f,
-    -0.54532498121261596680f,
-    -0.54661017656326293945f,
-    -0.54789406061172485352f,
-    -0.54917663335800170898f,
-    -0.55045795440673828125f,
-    -0.55173796415328979492f,
-    -0.55301672220230102539f,
-    -0.55429410934448242188f,
-    -0.55557024478912353516f,
-    -0.55684500932693481445f,
-    -0.55811852216720581055f,
-    -0.55939072370529174805f,
-    -0.56066155433654785156f,
-    -0.56193113327026367188f,
-    -0.56319934129714965820f,
-    -0.56446623802185058594f,
-    -0.56573182344436645508f,
-    -0.56699603796005249023f,
-    -0.56825894117355346680f,
-    -0.56952053308486938477f,
-    -0.57078075408935546875f,
-    -0.57203960418701171875f,
-    -0.57329714298248291016f,
-    -0.57455337047576904297f,
-    -0.57580816745758056641f,
-    -0.57706165313720703125f,
-    -0.57831376791000366211f,
-    -0.57956457138061523438f,
-    -0.58081394433975219727f,
-    -0.58206200599670410156f,
-    -0.58330863714218139648f,
-    -0.58455395698547363281f,
-    -0.58579784631729125977f,
-    -0.58704036474227905273f,
-    -0.58828157186508178711f,
-    -0.58952128887176513672f,
-    -0.59075969457626342773f,
-    -0.59199666976928710938f,
-    -0.59323227405548095703f,
-    -0.59446650743484497070f,
-    -0.59569931030273437500f,
-    -0.59693068265914916992f,
-    -0.59816068410873413086f,
-    -0.59938931465148925781f,
-    -0.60061645507812500000f,
-    -0.60184222459793090820f,
-    -0.60306662321090698242f,
-    -0.60428953170776367188f,
-    -0.60551106929779052734f,
-    -0.60673111677169799805f,
-    -0.60794979333877563477f,
-    -0.60916703939437866211f,
-    -0.61038279533386230469f,
-    -0.61159718036651611328f,
-    -0.61281007528305053711f,
-    -0.61402153968811035156f,
-    -0.61523157358169555664f,
-    -0.61644017696380615234f,
-    -0.61764729022979736328f,
-    -0.61885297298431396484f,
-    -0.62005722522735595703f,
-    -0.62125998735427856445f,
-    -0.62246125936508178711f,
-    -0.62366110086441040039f,
-    -0.62485951185226440430f,
-    -0.62605637311935424805f,
-    -0.62725180387496948242f,
-    -0.62844574451446533203f,
-    -0.62963825464248657227f,
-    -0.63082921504974365234f,
-    -0.63201874494552612305f,
-    -0.63320678472518920898f,
-    -0.63439327478408813477f,
-    -0.63557833433151245117f,
-    -0.63676184415817260742f,
-    -0.63794392347335815430f,
-    -0.63912445306777954102f,
-    -0.64030349254608154297f,
-    -0.64148104190826416016f,
-    -0.64265704154968261719f,
-    -0.64383155107498168945f,
-    -0.64500451087951660156f,
-    -0.64617604017257690430f,
-    -0.64734596014022827148f,
-    -0.64851438999176025391f,
-    -0.64968132972717285156f,
-    -0.65084666013717651367f,
-    -0.65201056003570556641f,
-    -0.65317285060882568359f,
-    -0.65433359146118164062f,
-    -0.65549284219741821289f,
-    -0.65665054321289062500f,
-    -0.65780669450759887695f,
-    -0.65896129608154296875f,
-    -0.66011434793472290039f,
-    -0.66126585006713867188f,
-    -0.66241580247879028320f,
-    -0.66356414556503295898f,
-    -0.66471099853515625000f,
-    -0.66585624217987060547f,
-    -0.66699993610382080078f,
-    -0.66814202070236206055f,
-    -0.66928261518478393555f,
-    -0.67042154073715209961f,
-    -0.67155897617340087891f,
-    -0.67269474267959594727f,
-    -0.67382901906967163086f,
-    -0.67496162652969360352f,
-    -0.67609268426895141602f,
-    -0.67722219228744506836f,
-    -0.67835003137588500977f,
-    -0.67947632074356079102f,
-    -0.68060100078582763672f,
-    -0.68172407150268554688f,
-    -0.68284553289413452148f,
-    -0.68396538496017456055f,
-    -0.68508368730545043945f,
-    -0.68620032072067260742f,
-    -0.68731534481048583984f,
-    -0.68842875957489013672f,
-    -0.68954056501388549805f,
-    -0.69065070152282714844f,
-    -0.69175922870635986328f,
-    -0.69286614656448364258f,
-    -0.69397145509719848633f,
-    -0.69507509469985961914f,
-    -0.69617712497711181641f,
-    -0.69727748632431030273f,
-    -0.69837623834609985352f,
-    -0.69947332143783569336f,
-    -0.70056879520416259766f,
-    -0.70166260004043579102f,
-    -0.70275473594665527344f,
-    -0.70384526252746582031f,
-    -0.70493406057357788086f,
-    -0.70602124929428100586f,
-    -0.70710676908493041992f,
-    -0.70819061994552612305f,
-    -0.70927280187606811523f,
-    -0.71035337448120117188f,
-    -0.71143221855163574219f,
-    -0.71250939369201660156f,
-    -0.71358484029769897461f,
-    -0.71465867757797241211f,
-    -0.71573084592819213867f,
-    -0.71680128574371337891f,
-    -0.71787005662918090820f,
-    -0.71893709897994995117f,
-    -0.72000253200531005859f,
-    -0.72106617689132690430f,
-    -0.72212821245193481445f,
-    -0.72318845987319946289f,
-    -0.72424709796905517578f,
-    -0.72530394792556762695f,
-    -0.72635912895202636719f,
-    -0.72741264104843139648f,
-    -0.72846436500549316406f,
-    -0.72951442003250122070f,
-    -0.73056274652481079102f,
-    -0.73160940408706665039f,
-    -0.73265427350997924805f,
-    -0.73369741439819335938f,
-    -0.73473888635635375977f,
-    -0.73577857017517089844f,
-    -0.73681658506393432617f,
-    -0.73785281181335449219f,
-    -0.73888731002807617188f,
-    -0.73992007970809936523f,
-    -0.74095112085342407227f,
-    -0.74198043346405029297f,
-    -0.74300795793533325195f,
-    -0.74403375387191772461f,
-    -0.74505776166915893555f,
-    -0.74608010053634643555f,
-    -0.74710059165954589844f,
-    -0.74811935424804687500f,
-    -0.74913638830184936523f,
-    -0.75015163421630859375f,
-    -0.75116515159606933594f,
-    -0.75217682123184204102f,
-    -0.75318682193756103516f,
-    -0.75419497489929199219f,
-    -0.75520139932632446289f,
-    -0.75620597600936889648f,
-    -0.75720882415771484375f,
-    -0.75820988416671752930f,
-    -0.75920921564102172852f,
-    -0.76020669937133789062f,
-    -0.76120239496231079102f,
-    -0.76219630241394042969f,
-    -0.76318842172622680664f,
-    -0.76417875289916992188f,
-    -0.76516723632812500000f,
-    -0.76615399122238159180f,
-    -0.76713889837265014648f,
-    -0.76812201738357543945f,
-    -0.76910334825515747070f,
-    -0.77008283138275146484f,
-    -0.77106052637100219727f,
-    -0.77203637361526489258f,
-    -0.77301043272018432617f,
-    -0.77398270368576049805f,
-    -0.77495312690734863281f,
-    -0.77592170238494873047f,
-    -0.77688848972320556641f,
-    -0.77785342931747436523f,
-    -0.77881652116775512695f,
-    -0.77977776527404785156f,
-    -0.78073722124099731445f,
-    -0.78169482946395874023f,
-    -0.78265058994293212891f,
-    -0.78360450267791748047f,
-    -0.78455656766891479492f,
-    -0.78550684452056884766f,
-    -0.78645521402359008789f,
-    -0.78740173578262329102f,
-    -0.78834640979766845703f,
-    -0.78928923606872558594f,
-    -0.79023021459579467773f,
-    -0.79116934537887573242f,
-    -0.79210656881332397461f,
-    -0.79304194450378417969f,
-    -0.79397547245025634766f,
-    -0.79490715265274047852f,
-    -0.79583692550659179688f,
-    -0.79676479101181030273f,
-    -0.79769086837768554688f,
-    -0.79861497879028320312f,
-    -0.79953724145889282227f,
-    -0.80045765638351440430f,
-    -0.80137616395950317383f,
-    -0.80229282379150390625f,
-    -0.80320751667022705078f,
-    -0.80412036180496215820f,
-    -0.80503135919570922852f,
-    -0.80594038963317871094f,
-    -0.80684757232666015625f,
-    -0.80775284767150878906f,
-    -0.80865615606307983398f,
-    -0.80955761671066284180f,
-    -0.81045717000961303711f,
-    -0.81135487556457519531f,
-    -0.81225061416625976562f,
-    -0.81314438581466674805f,
-    -0.81403630971908569336f,
-    -0.81492632627487182617f,
-    -0.81581443548202514648f,
-    -0.81670057773590087891f,
-    -0.81758481264114379883f,
-    -0.81846714019775390625f,
-    -0.81934750080108642578f,
-    -0.82022595405578613281f,
-    -0.82110249996185302734f,
-    -0.82197713851928710938f,
-    -0.82284981012344360352f,
-    -0.82372051477432250977f,
-    -0.82458931207656860352f,
-    -0.82545614242553710938f,
-    -0.82632106542587280273f,
-    -0.82718402147293090820f,
-    -0.82804507017135620117f,
-    -0.82890409231185913086f,
-    -0.82976120710372924805f,
-    -0.83061641454696655273f,
-    -0.83146959543228149414f,
-    -0.83232086896896362305f,
-    -0.83317017555236816406f,
-    -0.83401751518249511719f,
-    -0.83486288785934448242f,
-    -0.83570629358291625977f,
-    -0.83654773235321044922f,
-    -0.83738720417022705078f,
-    -0.83822470903396606445f,
-    -0.83906024694442749023f,
-    -0.83989381790161132812f,
-    -0.84072536230087280273f,
-    -0.84155499935150146484f,
-    -0.84238260984420776367f,
-    -0.84320825338363647461f,
-    -0.84403187036514282227f,
-    -0.84485357999801635742f,
-    -0.84567326307296752930f,
-    -0.84649091958999633789f,
-    -0.84730660915374755859f,
-    -0.84812033176422119141f,
-    -0.84893202781677246094f,
-    -0.84974175691604614258f,
-    -0.85054945945739746094f,
-    -0.85135519504547119141f,
-    -0.85215890407562255859f,
-    -0.85296058654785156250f,
-    -0.85376030206680297852f,
-    -0.85455799102783203125f,
-    -0.85535365343093872070f,
-    -0.85614734888076782227f,
-    -0.85693895816802978516f,
-    -0.85772860050201416016f,
-    -0.85851621627807617188f,
-    -0.85930180549621582031f,
-    -0.86008536815643310547f,
-    -0.86086696386337280273f,
-    -0.86164647340774536133f,
-    -0.86242395639419555664f,
-    -0.86319941282272338867f,
-    -0.86397284269332885742f,
-    -0.86474424600601196289f,
-    -0.86551362276077270508f,
-    -0.86628097295761108398f,
-    -0.86704623699188232422f,
-    -0.86780947446823120117f,
-    -0.86857068538665771484f,
-    -0.86932986974716186523f,
-    -0.87008696794509887695f,
-    -0.87084203958511352539f,
-    -0.87159508466720581055f,
-    -0.87234604358673095703f,
-    -0.87309497594833374023f,
-    -0.87384182214736938477f,
-    -0.87458664178848266602f,
-    -0.87532937526702880859f,
-    -0.87607008218765258789f,
-    -0.87680870294570922852f,
-    -0.87754529714584350586f,
-    -0.87827980518341064453f,
-    -0.87901222705841064453f,
-    -0.87974262237548828125f,
-    -0.88047087192535400391f,
-    -0.88119709491729736328f,
-    -0.88192129135131835938f,
-    -0.88264334201812744141f,
-    -0.88336336612701416016f,
-    -0.88408124446868896484f,
-    -0.88479709625244140625f,
-    -0.88551086187362670898f,
-    -0.88622254133224487305f,
-    -0.88693213462829589844f,
-    -0.88763964176177978516f,
-    -0.88834506273269653320f,
-    -0.88904833793640136719f,
-    -0.88974958658218383789f,
-    -0.89044874906539916992f,
-    -0.89114576578140258789f,
-    -0.89184069633483886719f,
-    -0.89253354072570800781f,
-    -0.89322429895401000977f,
-    -0.89391297101974487305f,
-    -0.89459949731826782227f,
-    -0.89528393745422363281f,
-    -0.89596623182296752930f,
-    -0.89664649963378906250f,
-    -0.89732456207275390625f,
-    -0.89800059795379638672f,
-    -0.89867448806762695312f,
-    -0.89934623241424560547f,
-    -0.90001589059829711914f,
-    -0.90068340301513671875f,
-    -0.90134882926940917969f,
-    -0.90201216936111450195f,
-    -0.90267330408096313477f,
-    -0.90333235263824462891f,
-    -0.90398931503295898438f,
-    -0.90464407205581665039f,
-    -0.90529674291610717773f,
-    -0.90594726800918579102f,
-    -0.90659570693969726562f,
-    -0.90724200010299682617f,
-    -0.90788608789443969727f,
-    -0.90852808952331542969f,
-    -0.90916800498962402344f,
-    -0.90980571508407592773f,
-    -0.91044127941131591797f,
-    -0.91107475757598876953f,
-    -0.91170603036880493164f,
-    -0.91233515739440917969f,
-    -0.91296219825744628906f,
-    -0.91358703374862670898f,
-    -0.91420978307723999023f,
-    -0.91483032703399658203f,
-    -0.91544872522354125977f,
-    -0.91606497764587402344f,
-    -0.91667908430099487305f,
-    -0.91729098558425903320f,
-    -0.91790080070495605469f,
-    -0.91850841045379638672f,
-    -0.91911387443542480469f,
-    -0.91971713304519653320f,
-    -0.92031830549240112305f,
-    -0.92091721296310424805f,
-    -0.92151403427124023438f,
-    -0.92210865020751953125f,
-    -0.92270112037658691406f,
-    -0.92329144477844238281f,
-    -0.92387950420379638672f,
-    -0.92446547746658325195f,
-    -0.92504924535751342773f,
-    -0.92563080787658691406f,
-    -0.92621022462844848633f,
-    -0.92678749561309814453f,
-    -0.92736250162124633789f,
-    -0.92793542146682739258f,
-    -0.92850607633590698242f,
-    -0.92907458543777465820f,
-    -0.92964088916778564453f,
-    -0.93020504713058471680f,
-    -0.93076694011688232422f,
-    -0.93132668733596801758f,
-    -0.93188428878784179688f,
-    -0.93243962526321411133f,
-    -0.93299281597137451172f,
-    -0.93354380130767822266f,
-    -0.93409252166748046875f,
-    -0.93463915586471557617f,
-    -0.93518352508544921875f,
-    -0.93572568893432617188f,
-    -0.93626564741134643555f,
-    -0.93680346012115478516f,
-    -0.93733900785446166992f,
-    -0.93787235021591186523f,
-    -0.93840354681015014648f,
-    -0.93893247842788696289f,
-    -0.93945920467376708984f,
-    -0.93998372554779052734f,
-    -0.94050604104995727539f,
-    -0.94102615118026733398f,
-    -0.94154405593872070312f,
-    -0.94205975532531738281f,
-    -0.94257318973541259766f,
-    -0.94308441877365112305f,
-    -0.94359344244003295898f,
-    -0.94410026073455810547f,
-    -0.94460481405258178711f,
-    -0.94510722160339355469f,
-    -0.94560730457305908203f,
-    -0.94610524177551269531f,
-    -0.94660091400146484375f,
-    -0.94709438085556030273f,
-    -0.94758558273315429688f,
-    -0.94807457923889160156f,
-    -0.94856137037277221680f,
-    -0.94904589653015136719f,
-    -0.94952815771102905273f,
-    -0.95000827312469482422f,
-    -0.95048606395721435547f,
-    -0.95096164941787719727f,
-    -0.95143502950668334961f,
-    -0.95190614461898803711f,
-    -0.95237499475479125977f,
-    -0.95284163951873779297f,
-    -0.95330601930618286133f,
-    -0.95376819372177124023f,
-    -0.95422810316085815430f,
-    -0.95468574762344360352f,
-    -0.95514118671417236328f,
-    -0.95559436082839965820f,
-    -0.95604526996612548828f,
-    -0.95649391412734985352f,
-    -0.95694035291671752930f,
-    -0.95738452672958374023f,
-    -0.95782643556594848633f,
-    -0.95826607942581176758f,
-    -0.95870345830917358398f,
-    -0.95913863182067871094f,
-    -0.95957154035568237305f,
-    -0.96000212430953979492f,
-    -0.96043050289154052734f,
-    -0.96085661649703979492f,
-    -0.96128046512603759766f,
-    -0.96170204877853393555f,
-    -0.96212142705917358398f,
-    -0.96253848075866699219f,
-    -0.96295326948165893555f,
-    -0.96336579322814941406f,
-    -0.96377605199813842773f,
-    -0.96418404579162597656f,
-    -0.96458977460861206055f,
-    -0.96499323844909667969f,
-    -0.96539443731307983398f,
-    -0.96579337120056152344f,
-    -0.96618998050689697266f,
-    -0.96658438444137573242f,
-    -0.96697646379470825195f,
-    -0.96736627817153930664f,
-    -0.96775382757186889648f,
-    -0.96813911199569702148f,
-    -0.96852207183837890625f,
-    -0.96890282630920410156f,
-    -0.96928125619888305664f,
-    -0.96965736150741577148f,
-    -0.97003126144409179688f,
-    -0.97040283679962158203f,
-    -0.97077214717864990234f,
-    -0.97113913297653198242f,
-    -0.97150391340255737305f,
-    -0.97186630964279174805f,
-    -0.97222650051116943359f,
-    -0.97258436679840087891f,
-    -0.97293996810913085938f,
-    -0.97329324483871459961f,
-    -0.97364425659179687500f,
-    -0.97399294376373291016f,
-    -0.97433936595916748047f,
-    -0.97468352317810058594f,
-    -0.97502535581588745117f,
-    -0.97536486387252807617f,
-    -0.97570210695266723633f,
-    -0.97603708505630493164f,
-    -0.97636973857879638672f,
-    -0.97670006752014160156f,
-    -0.97702813148498535156f,
-    -0.97735387086868286133f,
-    -0.97767734527587890625f,
-    -0.97799849510192871094f,
-    -0.97831737995147705078f,
-    -0.97863394021987915039f,
-    -0.97894817590713500977f,
-    -0.97926014661788940430f,
-    -0.97956979274749755859f,
-    -0.97987711429595947266f,
-    -0.98018211126327514648f,
-    -0.98048484325408935547f,
-    -0.98078525066375732422f,
-    -0.98108339309692382812f,
-    -0.98137921094894409180f,
-    -0.98167270421981811523f,
-    -0.98196387290954589844f,
-    -0.98225271701812744141f,
-    -0.98253929615020751953f,
-    -0.98282355070114135742f,
-    -0.98310548067092895508f,
-    -0.98338508605957031250f,
-    -0.98366242647171020508f,
-    -0.98393744230270385742f,
-    -0.98421007394790649414f,
-    -0.98448044061660766602f,
-    -0.98474848270416259766f,
-    -0.98501425981521606445f,
-    -0.98527765274047851562f,
-    -0.98553872108459472656f,
-    -0.98579752445220947266f,
-    -0.98605394363403320312f,
-    -0.98630809783935546875f,
-    -0.98655992746353149414f,
-    -0.98680937290191650391f,
-    -0.98705655336380004883f,
-    -0.98730140924453735352f,
-    -0.98754394054412841797f,
-    -0.98778414726257324219f,
-    -0.98802202939987182617f,
-    -0.98825758695602416992f,
-    -0.98849081993103027344f,
-    -0.98872166872024536133f,
-    -0.98895025253295898438f,
-    -0.98917651176452636719f,
-    -0.98940044641494750977f,
-    -0.98962199687957763672f,
-    -0.98984128236770629883f,
-    -0.99005818367004394531f,
-    -0.99027281999588012695f,
-    -0.99048507213592529297f,
-    -0.99069499969482421875f,
-    -0.99090266227722167969f,
-    -0.99110794067382812500f,
-    -0.99131083488464355469f,
-    -0.99151146411895751953f,
-    -0.99170976877212524414f,
-    -0.99190568923950195312f,
-    -0.99209928512573242188f,
-    -0.99229061603546142578f,
-    -0.99247956275939941406f,
-    -0.99266612529754638672f,
-    -0.99285042285919189453f,
-    -0.99303233623504638672f,
-    -0.99321192502975463867f,
-    -0.99338918924331665039f,
-    -0.99356412887573242188f,
-    -0.99373674392700195312f,
-    -0.99390697479248046875f,
-    -0.99407488107681274414f,
-    -0.99424046277999877930f,
-    -0.99440366029739379883f,
-    -0.99456459283828735352f,
-    -0.99472314119338989258f,
-    -0.99487930536270141602f,
-    -0.99503320455551147461f,
-    -0.99518471956253051758f,
-    -0.99533390998840332031f,
-    -0.99548077583312988281f,
-    -0.99562525749206542969f,
-    -0.99576741456985473633f,
-    -0.99590724706649780273f,
-    -0.99604469537734985352f,
-    -0.99617981910705566406f,
-    -0.99631261825561523438f,
-    -0.99644303321838378906f,
-    -0.99657112360000610352f,
-    -0.99669688940048217773f,
-    -0.99682027101516723633f,
-    -0.99694132804870605469f,
-    -0.99706006050109863281f,
-    -0.99717640876770019531f,
-    -0.99729043245315551758f,
-    -0.99740213155746459961f,
-    -0.99751144647598266602f,
-    -0.99761843681335449219f,
-    -0.99772304296493530273f,
-    -0.99782532453536987305f,
-    -0.99792528152465820312f,
-    -0.99802285432815551758f,
-    -0.99811810255050659180f,
-    -0.99821102619171142578f,
-    -0.99830156564712524414f,
-    -0.99838972091674804688f,
-    -0.99847555160522460938f,
-    -0.99855905771255493164f,
-    -0.99864023923873901367f,
-    -0.99871903657913208008f,
-    -0.99879544973373413086f,
-    -0.99886953830718994141f,
-    -0.99894130229949951172f,
-    -0.99901068210601806641f,
-    -0.99907773733139038086f,
-    -0.99914240837097167969f,
-    -0.99920475482940673828f,
-    -0.99926477670669555664f,
-    -0.99932235479354858398f,
-    -0.99937766790390014648f,
-    -0.99943059682846069336f,
-    -0.99948120117187500000f,
-    -0.99952942132949829102f,
-    -0.99957531690597534180f,
-    -0.99961882829666137695f,
-    -0.99966001510620117188f,
-    -0.99969881772994995117f,
-    -0.99973529577255249023f,
-    -0.99976938962936401367f,
-    -0.99980115890502929688f,
-    -0.99983060359954833984f,
-    -0.99985766410827636719f,
-    -0.99988234043121337891f,
-    -0.99990469217300415039f,
-    -0.99992471933364868164f,
-    -0.99994236230850219727f,
-    -0.99995762109756469727f,
-    -0.99997061491012573242f,
-    -0.99998116493225097656f,
-    -0.99998939037322998047f,
-    -0.99999529123306274414f,
-    -0.99999880790710449219f,
-    -1.00000000000000000000f,
-    -0.99999880790710449219f,
-    -0.99999529123306274414f,
-    -0.99998939037322998047f,
-    -0.99998116493225097656f,
-    -0.99997061491012573242f,
-    -0.99995762109756469727f,
-    -0.99994236230850219727f,
-    -0.99992471933364868164f,
-    -0.99990469217300415039f,
-    -0.99988234043121337891f,
-    -0.99985766410827636719f,
-    -0.99983060359954833984f,
-    -0.99980115890502929688f,
-    -0.99976938962936401367f,
-    -0.99973529577255249023f,
-    -0.99969881772994995117f,
-    -0.99966001510620117188f,
-    -0.99961882829666137695f,
-    -0.99957531690597534180f,
-    -0.99952942132949829102f,
-    -0.99948120117187500000f,
-    -0.99943059682846069336f,
-    -0.99937766790390014648f,
-    -0.99932235479354858398f,
-    -0.99926477670669555664f,
-    -0.99920475482940673828f,
-    -0.99914240837097167969f,
-    -0.99907773733139038086f,
-    -0.99901068210601806641f,
-    -0.99894130229949951172f,
-    -0.99886953830718994141f,
-    -0.99879544973373413086f,
-    -0.99871903657913208008f,
-    -0.99864023923873901367f,
-    -0.99855905771255493164f,
-    -0.99847555160522460938f,
-    -0.99838972091674804688f,
-    -0.99830156564712524414f,
-    -0.99821102619171142578f,
-    -0.99811810255050659180f,
-    -0.99802285432815551758f,
-    -0.99792528152465820312f,
-    -0.99782532453536987305f,
-    -0.99772304296493530273f,
-    -0.99761843681335449219f,
-    -0.99751144647598266602f,
-    -0.99740213155746459961f,
-    -0.99729043245315551758f,
-    -0.99717640876770019531f,
-    -0.99706006050109863281f,
-    -0.99694132804870605469f,
-    -0.99682027101516723633f,
-    -0.99669688940048217773f,
-    -0.99657112360000610352f,
-    -0.99644303321838378906f,
-    -0.99631261825561523438f,
-    -0.99617981910705566406f,
-    -0.99604469537734985352f,
-    -0.99590724706649780273f,
-    -0.99576741456985473633f,
-    -0.99562525749206542969f,
-    -0.99548077583312988281f,
-    -0.99533390998840332031f,
-    -0.99518471956253051758f,
-    -0.99503320455551147461f,
-    -0.99487930536270141602f,
-    -0.99472314119338989258f,
-    -0.99456459283828735352f,
-    -0.99440366029739379883f,
-    -0.99424046277999877930f,
-    -0.99407488107681274414f,
-    -0.99390697479248046875f,
-    -0.99373674392700195312f,
-    -0.99356412887573242188f,
-    -0.99338918924331665039f,
-    -0.99321192502975463867f,
-    -0.99303233623504638672f,
-    -0.99285042285919189453f,
-    -0.99266612529754638672f,
-    -0.99247956275939941406f,
-    -0.99229061603546142578f,
-    -0.99209928512573242188f,
-    -0.99190568923950195312f,
-    -0.99170976877212524414f,
-    -0.99151146411895751953f,
-    -0.99131083488464355469f,
-    -0.99110794067382812500f,
-    -0.99090266227722167969f,
-    -0.99069499969482421875f,
-    -0.99048507213592529297f,
-    -0.99027281999588012695f,
-    -0.99005818367004394531f,
-    -0.98984128236770629883f,
-    -0.98962199687957763672f,
-    -0.98940044641494750977f,
-    -0.98917651176452636719f,
-    -0.98895025253295898438f,
-    -0.98872166872024536133f,
-    -0.98849081993103027344f,
-    -0.98825758695602416992f,
-    -0.98802202939987182617f,
-    -0.98778414726257324219f,
-    -0.98754394054412841797f,
-    -0.98730140924453735352f,
-    -0.98705655336380004883f,
-    -0.98680937290191650391f,
-    -0.98655992746353149414f,
-    -0.98630809783935546875f,
-    -0.98605394363403320312f,
-    -0.98579752445220947266f,
-    -0.98553872108459472656f,
-    -0.98527765274047851562f,
-    -0.98501425981521606445f,
-    -0.98474848270416259766f,
-    -0.98448044061660766602f,
-    -0.98421007394790649414f,
-    -0.98393744230270385742f,
-    -0.98366242647171020508f,
-    -0.98338508605957031250f,
-    -0.98310548067092895508f,
-    -0.98282355070114135742f,
-    -0.98253929615020751953f,
-    -0.98225271701812744141f,
-    -0.98196387290954589844f,
-    -0.98167270421981811523f,
-    -0.98137921094894409180f,
-    -0.98108339309692382812f,
-    -0.98078525066375732422f,
-    -0.98048484325408935547f,
-    -0.98018211126327514648f,
-    -0.97987711429595947266f,
-    -0.97956979274749755859f,
-    -0.97926014661788940430f,
-    -0.97894817590713500977f,
-    -0.97863394021987915039f,
-    -0.97831737995147705078f,
-    -0.97799849510192871094f,
-    -0.97767734527587890625f,
-    -0.97735387086868286133f,
-    -0.97702813148498535156f,
-    -0.97670006752014160156f,
-    -0.97636973857879638672f,
-    -0.97603708505630493164f,
-    -0.97570210695266723633f,
-    -0.97536486387252807617f,
-    -0.97502535581588745117f,
-    -0.97468352317810058594f,
-    -0.97433936595916748047f,
-    -0.97399294376373291016f,
-    -0.97364425659179687500f,
-    -0.97329324483871459961f,
-    -0.97293996810913085938f,
-    -0.97258436679840087891f,
-    -0.97222650051116943359f,
-    -0.97186630964279174805f,
-    -0.97150391340255737305f,
-    -0.97113913297653198242f,
-    -0.97077214717864990234f,
-    -0.97040283679962158203f,
-    -0.97003126144409179688f,
-    -0.96965736150741577148f,
-    -0.96928125619888305664f,
-    -0.96890282630920410156f,
-    -0.96852207183837890625f,
-    -0.96813911199569702148f,
-    -0.96775382757186889648f,
-    -0.96736627817153930664f,
-    -0.96697646379470825195f,
-    -0.96658438444137573242f,
-    -0.96618998050689697266f,
-    -0.96579337120056152344f,
-    -0.96539443731307983398f,
-    -0.96499323844909667969f,
-    -0.96458977460861206055f,
-    -0.96418404579162597656f,
-    -0.96377605199813842773f,
-    -0.96336579322814941406f,
-    -0.96295326948165893555f,
-    -0.96253848075866699219f,
-    -0.96212142705917358398f,
-    -0.96170204877853393555f,
-    -0.96128046512603759766f,
-    -0.96085661649703979492f,
-    -0.96043050289154052734f,
-    -0.96000212430953979492f,
-    -0.95957154035568237305f,
-    -0.95913863182067871094f,
-    -0.95870345830917358398f,
-    -0.95826607942581176758f,
-    -0.95782643556594848633f,
-    -0.95738452672958374023f,
-    -0.95694035291671752930f,
-    -0.95649391412734985352f,
-    -0.95604526996612548828f,
-    -0.95559436082839965820f,
-    -0.95514118671417236328f,
-    -0.95468574762344360352f,
-    -0.95422810316085815430f,
-    -0.95376819372177124023f,
-    -0.95330601930618286133f,
-    -0.95284163951873779297f,
-    -0.95237499475479125977f,
-    -0.95190614461898803711f,
-    -0.95143502950668334961f,
-    -0.95096164941787719727f,
-    -0.95048606395721435547f,
-    -0.95000827312469482422f,
-    -0.94952815771102905273f,
-    -0.94904589653015136719f,
-    -0.94856137037277221680f,
-    -0.94807457923889160156f,
-    -0.94758558273315429688f,
-    -0.94709438085556030273f,
-    -0.94660091400146484375f,
-    -0.94610524177551269531f,
-    -0.94560730457305908203f,
-    -0.94510722160339355469f,
-    -0.94460481405258178711f,
-    -0.94410026073455810547f,
-    -0.94359344244003295898f,
-    -0.94308441877365112305f,
-    -0.94257318973541259766f,
-    -0.94205975532531738281f,
-    -0.94154405593872070312f,
-    -0.94102615118026733398f,
-    -0.94050604104995727539f,
-    -0.93998372554779052734f,
-    -0.93945920467376708984f,
-    -0.93893247842788696289f,
-    -0.93840354681015014648f,
-    -0.93787235021591186523f,
-    -0.93733900785446166992f,
-    -0.93680346012115478516f,
-    -0.93626564741134643555f,
-    -0.93572568893432617188f,
-    -0.93518352508544921875f,
-    -0.93463915586471557617f,
-    -0.93409252166748046875f,
-    -0.93354380130767822266f,
-    -0.93299281597137451172f,
-    -0.93243962526321411133f,
-    -0.93188428878784179688f,
-    -0.93132668733596801758f,
-    -0.93076694011688232422f,
-    -0.93020504713058471680f,
-    -0.92964088916778564453f,
-    -0.92907458543777465820f,
-    -0.92850607633590698242f,
-    -0.92793542146682739258f,
-    -0.92736250162124633789f,
-    -0.92678749561309814453f,
-    -0.92621022462844848633f,
-    -0.92563080787658691406f,
-    -0.92504924535751342773f,
-    -0.92446547746658325195f,
-    -0.92387950420379638672f,
-    -0.92329144477844238281f,
-    -0.92270112037658691406f,
-    -0.92210865020751953125f,
-    -0.92151403427124023438f,
-    -0.92091721296310424805f,
-    -0.92031830549240112305f,
-    -0.91971713304519653320f,
-    -0.91911387443542480469f,
-    -0.91850841045379638672f,
-    -0.91790080070495605469f,
-    -0.91729098558425903320f,
-    -0.91667908430099487305f,
-    -0.91606497764587402344f,
-    -0.91544872522354125977f,
-    -0.91483032703399658203f,
-    -0.91420978307723999023f,
-    -0.91358703374862670898f,
-    -0.91296219825744628906f,
-    -0.91233515739440917969f,
-    -0.91170603036880493164f,
-    -0.91107475757598876953f,
-    -0.91044127941131591797f,
-    -0.90980571508407592773f,
-    -0.90916800498962402344f,
-    -0.90852808952331542969f,
-    -0.90788608789443969727f,
-    -0.90724200010299682617f,
-    -0.90659570693969726562f,
-    -0.90594726800918579102f,
-    -0.90529674291610717773f,
-    -0.90464407205581665039f,
-    -0.90398931503295898438f,
-    -0.90333235263824462891f,
-    -0.90267330408096313477f,
-    -0.90201216936111450195f,
-    -0.90134882926940917969f,
-    -0.90068340301513671875f,
-    -0.90001589059829711914f,
-    -0.89934623241424560547f,
-    -0.89867448806762695312f,
-    -0.89800059795379638672f,
-    -0.89732456207275390625f,
-    -0.89664649963378906250f,
-    -0.89596623182296752930f,
-    -0.89528393745422363281f,
-    -0.89459949731826782227f,
-    -0.89391297101974487305f,
-    -0.89322429895401000977f,
-    -0.89253354072570800781f,
-    -0.89184069633483886719f,
-    -0.89114576578140258789f,
-    -0.89044874906539916992f,
-    -0.88974958658218383789f,
-    -0.88904833793640136719f,
-    -0.88834506273269653320f,
-    -0.88763964176177978516f,
-    -0.88693213462829589844f,
-    -0.88622254133224487305f,
-    -0.88551086187362670898f,
-    -0.88479709625244140625f,
-    -0.88408124446868896484f,
-    -0.88336336612701416016f,
-    -0.88264334201812744141f,
-    -0.88192129135131835938f,
-    -0.88119709491729736328f,
-    -0.88047087192535400391f,
-    -0.87974262237548828125f,
-    -0.87901222705841064453f,
-    -0.87827980518341064453f,
-    -0.87754529714584350586f,
-    -0.87680870294570922852f,
-    -0.87607008218765258789f,
-    -0.87532937526702880859f,
-    -0.87458664178848266602f,
-    -0.87384182214736938477f,
-    -0.87309497594833374023f,
-    -0.87234604358673095703f,
-    -0.87159508466720581055f,
-    -0.87084203958511352539f,
-    -0.87008696794509887695f,
-    -0.86932986974716186523f,
-    -0.86857068538665771484f,
-    -0.86780947446823120117f,
-    -0.86704623699188232422f,
-    -0.86628097295761108398f,
-    -0.86551362276077270508f,
-    -0.86474424600601196289f,
-    -0.86397284269332885742f,
-    -0.86319941282272338867f,
-    -0.86242395639419555664f,
-    -0.86164647340774536133f,
-    -0.86086696386337280273f,
-    -0.86008536815643310547f,
-    -0.85930180549621582031f,
-    -0.85851621627807617188f,
-    -0.85772860050201416016f,
-    -0.85693895816802978516f,
-    -0.85614734888076782227f,
-    -0.85535365343093872070f,
-    -0.85455799102783203125f,
-    -0.85376030206680297852f,
-    -0.85296058654785156250f,
-    -0.85215890407562255859f,
-    -0.85135519504547119141f,
-    -0.85054945945739746094f,
-    -0.84974175691604614258f,
-    -0.84893202781677246094f,
-    -0.84812033176422119141f,
-    -0.84730660915374755859f,
-    -0.84649091958999633789f,
-    -0.84567326307296752930f,
-    -0.84485357999801635742f,
-    -0.84403187036514282227f,
-    -0.84320825338363647461f,
-    -0.84238260984420776367f,
-    -0.84155499935150146484f,
-    -0.84072536230087280273f,
-    -0.83989381790161132812f,
-    -0.83906024694442749023f,
-    -0.83822470903396606445f,
-    -0.83738720417022705078f,
-    -0.83654773235321044922f,
-    -0.83570629358291625977f,
-    -0.83486288785934448242f,
-    -0.83401751518249511719f,
-    -0.83317017555236816406f,
-    -0.83232086896896362305f,
-    -0.83146959543228149414f,
-    -0.83061641454696655273f,
-    -0.82976120710372924805f,
-    -0.82890409231185913086f,
-    -0.82804507017135620117f,
-    -0.82718402147293090820f,
-    -0.82632106542587280273f,
-    -0.82545614242553710938f,
-    -0.82458931207656860352f,
-    -0.82372051477432250977f,
-    -0.82284981012344360352f,
-    -0.82197713851928710938f,
-    -0.82110249996185302734f,
-    -0.82022595405578613281f,
-    -0.81934750080108642578f,
-    -0.81846714019775390625f,
-    -0.81758481264114379883f,
-    -0.81670057773590087891f,
-    -0.81581443548202514648f,
-    -0.81492632627487182617f,
-    -0.81403630971908569336f,
-    -0.81314438581466674805f,
-    -0.81225061416625976562f,
-    -0.81135487556457519531f,
-    -0.81045717000961303711f,
-    -0.80955761671066284180f,
-    -0.80865615606307983398f,
-    -0.80775284767150878906f,
-    -0.80684757232666015625f,
-    -0.80594038963317871094f,
-    -0.80503135919570922852f,
-    -0.80412036180496215820f,
-    -0.80320751667022705078f,
-    -0.80229282379150390625f,
-    -0.80137616395950317383f,
-    -0.80045765638351440430f,
-    -0.79953724145889282227f,
-    -0.79861497879028320312f,
-    -0.79769086837768554688f,
-    -0.79676479101181030273f,
-    -0.79583692550659179688f,
-    -0.79490715265274047852f,
-    -0.79397547245025634766f,
-    -0.79304194450378417969f,
-    -0.79210656881332397461f,
-    -0.79116934537887573242f,
-    -0.79023021459579467773f,
-    -0.78928923606872558594f,
-    -0.78834640979766845703f,
-    -0.78740173578262329102f,
-    -0.78645521402359008789f,
-    -0.78550684452056884766f,
-    -0.78455656766891479492f,
-    -0.78360450267791748047f,
-    -0.78265058994293212891f,
-    -0.78169482946395874023f,
-    -0.78073722124099731445f,
-    -0.77977776527404785156f,
-    -0.77881652116775512695f,
-    -0.77785342931747436523f,
-    -0.77688848972320556641f,
-    -0.77592170238494873047f,
-    -0.77495312690734863281f,
-    -0.77398270368576049805f,
-    -0.77301043272018432617f,
-    -0.77203637361526489258f,
-    -0.77106052637100219727f,
-    -0.77008283138275146484f,
-    -0.76910334825515747070f,
-    -0.76812201738357543945f,
-    -0.76713889837265014648f,
-    -0.76615399122238159180f,
-    -0.76516723632812500000f,
-    -0.76417875289916992188f,
-    -0.76318842172622680664f,
-    -0.76219630241394042969f,
-    -0.76120239496231079102f,
-    -0.76020669937133789062f,
-    -0.75920921564102172852f,
-    -0.75820988416671752930f,
-    -0.75720882415771484375f,
-    -0.75620597600936889648f,
-    -0.75520139932632446289f,
-    -0.75419497489929199219f,
-    -0.75318682193756103516f,
-    -0.75217682123184204102f,
-    -0.75116515159606933594f,
-    -0.75015163421630859375f,
-    -0.74913638830184936523f,
-    -0.74811935424804687500f,
-    -0.74710059165954589844f,
-    -0.74608010053634643555f,
-    -0.74505776166915893555f,
-    -0.74403375387191772461f,
-    -0.74300795793533325195f,
-    -0.74198043346405029297f,
-    -0.74095112085342407227f,
-    -0.73992007970809936523f,
-    -0.73888731002807617188f,
-    -0.73785281181335449219f,
-    -0.73681658506393432617f,
-    -0.73577857017517089844f,
-    -0.73473888635635375977f,
-    -0.73369741439819335938f,
-    -0.73265427350997924805f,
-    -0.73160940408706665039f,
-    -0.73056274652481079102f,
-    -0.72951442003250122070f,
-    -0.72846436500549316406f,
-    -0.72741264104843139648f,
-    -0.72635912895202636719f,
-    -0.72530394792556762695f,
-    -0.72424709796905517578f,
-    -0.72318845987319946289f,
-    -0.72212821245193481445f,
-    -0.72106617689132690430f,
-    -0.72000253200531005859f,
-    -0.71893709897994995117f,
-    -0.71787005662918090820f,
-    -0.71680128574371337891f,
-    -0.71573084592819213867f,
-    -0.71465867757797241211f,
-    -0.71358484029769897461f,
-    -0.71250939369201660156f,
-    -0.71143221855163574219f,
-    -0.71035337448120117188f,
-    -0.70927280187606811523f,
-    -0.70819061994552612305f,
-    -0.70710676908493041992f,
-    -0.70602124929428100586f,
-    -0.70493406057357788086f,
-    -0.70384526252746582031f,
-    -0.70275473594665527344f,
-    -0.70166260004043579102f,
-    -0.70056879520416259766f,
-    -0.69947332143783569336f,
-    -0.69837623834609985352f,
-    -0.69727748632431030273f,
-    -0.69617712497711181641f,
-    -0.69507509469985961914f,
-    -0.69397145509719848633f,
-    -0.69286614656448364258f,
-    -0.69175922870635986328f,
-    -0.69065070152282714844f,
-    -0.68954056501388549805f,
-    -0.68842875957489013672f,
-    -0.68731534481048583984f,
-    -0.68620032072067260742f,
-    -0.68508368730545043945f,
-    -0.68396538496017456055f,
-    -0.68284553289413452148f,
-    -0.68172407150268554688f,
-    -0.68060100078582763672f,
-    -0.67947632074356079102f,
-    -0.67835003137588500977f,
-    -0.67722219228744506836f,
-    -0.67609268426895141602f,
-    -0.67496162652969360352f,
-    -0.67382901906967163086f,
-    -0.67269474267959594727f,
-    -0.67155897617340087891f,
-    -0.67042154073715209961f,
-    -0.66928261518478393555f,
-    -0.66814202070236206055f,
-    -0.66699993610382080078f,
-    -0.66585624217987060547f,
-    -0.66471099853515625000f,
-    -0.66356414556503295898f,
-    -0.66241580247879028320f,
-    -0.66126585006713867188f,
-    -0.66011434793472290039f,
-    -0.65896129608154296875f,
-    -0.65780669450759887695f,
-    -0.65665054321289062500f,
-    -0.65549284219741821289f,
-    -0.65433359146118164062f,
-    -0.65317285060882568359f,
-    -0.65201056003570556641f,
-    -0.65084666013717651367f,
-    -0.64968132972717285156f,
-    -0.64851438999176025391f,
-    -0.64734596014022827148f,
-    -0.64617604017257690430f,
-    -0.64500451087951660156f,
-    -0.64383155107498168945f,
-    -0.64265704154968261719f,
-    -0.64148104190826416016f,
-    -0.64030349254608154297f,
-    -0.63912445306777954102f,
-    -0.63794392347335815430f,
-    -0.63676184415817260742f,
-    -0.63557833433151245117f,
-    -0.63439327478408813477f,
-    -0.63320678472518920898f,
-    -0.63201874494552612305f,
-    -0.63082921504974365234f,
-    -0.62963825464248657227f,
-    -0.62844574451446533203f,
-    -0.62725180387496948242f,
-    -0.62605637311935424805f,
-    -0.62485951185226440430f,
-    -0.62366110086441040039f,
-    -0.62246125936508178711f,
-    -0.62125998735427856445f,
-    -0.62005722522735595703f,
-    -0.61885297298431396484f,
-    -0.61764729022979736328f,
-    -0.61644017696380615234f,
-    -0.61523157358169555664f,
-    -0.61402153968811035156f,
-    -0.61281007528305053711f,
-    -0.61159718036651611328f,
-    -0.61038279533386230469f,
-    -0.60916703939437866211f,
-    -0.60794979333877563477f,
-    -0.60673111677169799805f,
-    -0.60551106929779052734f,
-    -0.60428953170776367188f,
-    -0.60306662321090698242f,
-    -0.60184222459793090820f,
-    -0.60061645507812500000f,
-    -0.59938931465148925781f,
-    -0.59816068410873413086f,
-    -0.59693068265914916992f,
-    -0.59569931030273437500f,
-    -0.59446650743484497070f,
-    -0.59323227405548095703f,
-    -0.59199666976928710938f,
-    -0.59075969457626342773f,
-    -0.58952128887176513672f,
-    -0.58828157186508178711f,
-    -0.58704036474227905273f,
-    -0.58579784631729125977f,
-    -0.58455395698547363281f,
-    -0.58330863714218139648f,
-    -0.58206200599670410156f,
-    -0.58081394433975219727f,
-    -0.57956457138061523438f,
-    -0.57831376791000366211f,
-    -0.57706165313720703125f,
-    -0.57580816745758056641f,
-    -0.57455337047576904297f,
-    -0.57329714298248291016f,
-    -0.57203960418701171875f,
-    -0.57078075408935546875f,
-    -0.56952053308486938477f,
-    -0.56825894117355346680f,
-    -0.56699603796005249023f,
-    -0.56573182344436645508f,
-    -0.56446623802185058594f,
-    -0.56319934129714965820f,
-    -0.56193113327026367188f,
-    -0.56066155433654785156f,
-    -0.55939072370529174805f,
-    -0.55811852216720581055f,
-    -0.55684500932693481445f,
-    -0.55557024478912353516f,
-    -0.55429410934448242188f,
-    -0.55301672220230102539f,
-    -0.55173796415328979492f,
-    -0.55045795440673828125f,
-    -0.54917663335800170898f,
-    -0.54789406061172485352f,
-    -0.54661017656326293945f,
-    -0.54532498121261596680f,
-    -0.54403853416442871094f,
-    -0.54275077581405639648f,
-    -0.54146176576614379883f,
-    -0.54017144441604614258f,
-    -0.53887993097305297852f,
-    -0.53758704662322998047f,
-    -0.53629297018051147461f,
-    -0.53499764204025268555f,
-    -0.53370100259780883789f,
-    -0.53240311145782470703f,
-    -0.53110402822494506836f,
-    -0.52980363368988037109f,
-    -0.52850198745727539062f,
-    -0.52719914913177490234f,
-    -0.52589499950408935547f,
-    -0.52458965778350830078f,
-    -0.52328312397003173828f,
-    -0.52197527885437011719f,
-    -0.52066624164581298828f,
-    -0.51935601234436035156f,
-    -0.51804453134536743164f,
-    -0.51673179864883422852f,
-    -0.51541787385940551758f,
-    -0.51410275697708129883f,
-    -0.51278638839721679688f,
-    -0.51146882772445678711f,
-    -0.51015007495880126953f,
-    -0.50883013010025024414f,
-    -0.50750899314880371094f,
-    -0.50618666410446166992f,
-    -0.50486308336257934570f,
-    -0.50353837013244628906f,
-    -0.50221246480941772461f,
-    -0.50088536739349365234f,
-    -0.49955710768699645996f,
-    -0.49822765588760375977f,
-    -0.49689704179763793945f,
-    -0.49556526541709899902f,
-    -0.49423229694366455078f,
-    -0.49289819598197937012f,
-    -0.49156290292739868164f,
-    -0.49022647738456726074f,
-    -0.48888888955116271973f,
-    -0.48755016922950744629f,
-    -0.48621028661727905273f,
-    -0.48486924171447753906f,
-    -0.48352706432342529297f,
-    -0.48218378424644470215f,
-    -0.48083934187889099121f,
-    -0.47949376702308654785f,
-    -0.47814705967903137207f,
-    -0.47679921984672546387f,
-    -0.47545027732849121094f,
-    -0.47410020232200622559f,
-    -0.47274902462959289551f,
-    -0.47139674425125122070f,
-    -0.47004333138465881348f,
-    -0.46868881583213806152f,
-    -0.46733319759368896484f,
-    -0.46597650647163391113f,
-    -0.46461868286132812500f,
-    -0.46325978636741638184f,
-    -0.46189978718757629395f,
-    -0.46053871512413024902f,
-    -0.45917654037475585938f,
-    -0.45781329274177551270f,
-    -0.45644897222518920898f,
-    -0.45508357882499694824f,
-    -0.45371711254119873047f,
-    -0.45234957337379455566f,
-    -0.45098099112510681152f,
-    -0.44961133599281311035f,
-    -0.44824060797691345215f,
-    -0.44686883687973022461f,
-    -0.44549602270126342773f,
-    -0.44412213563919067383f,
-    -0.44274723529815673828f,
-    -0.44137126207351684570f,
-    -0.43999427556991577148f,
-    -0.43861624598503112793f,
-    -0.43723717331886291504f,
-    -0.43585708737373352051f,
-    -0.43447595834732055664f,
-    -0.43309381604194641113f,
-    -0.43171066045761108398f,
-    -0.43032649159431457520f,
-    -0.42894127964973449707f,
-    -0.42755508422851562500f,
-    -0.42616787552833557129f,
-    -0.42477968335151672363f,
-    -0.42339047789573669434f,
-    -0.42200025916099548340f,
-    -0.42060908675193786621f,
-    -0.41921690106391906738f,
-    -0.41782370209693908691f,
-    -0.41642954945564270020f,
-    -0.41503441333770751953f,
-    -0.41363832354545593262f,
-    -0.41224122047424316406f,
-    -0.41084316372871398926f,
-    -0.40944415330886840820f,
-    -0.40804415941238403320f,
-    -0.40664321184158325195f,
-    -0.40524131059646606445f,
-    -0.40383845567703247070f,
-    -0.40243464708328247070f,
-    -0.40102988481521606445f,
-    -0.39962419867515563965f,
-    -0.39821755886077880859f,
-    -0.39680999517440795898f,
-    -0.39540147781372070312f,
-    -0.39399203658103942871f,
-    -0.39258167147636413574f,
-    -0.39117038249969482422f,
-    -0.38975816965103149414f,
-    -0.38834503293037414551f,
-    -0.38693100214004516602f,
-    -0.38551604747772216797f,
-    -0.38410019874572753906f,
-    -0.38268342614173889160f,
-    -0.38126575946807861328f,
-    -0.37984719872474670410f,
-    -0.37842774391174316406f,
-    -0.37700742483139038086f,
-    -0.37558618187904357910f,
-    -0.37416407465934753418f,
-    -0.37274107336997985840f,
-    -0.37131720781326293945f,
-    -0.36989244818687438965f,
-    -0.36846682429313659668f,
-    -0.36704033613204956055f,
-    -0.36561298370361328125f,
-    -0.36418479681015014648f,
-    -0.36275571584701538086f,
-    -0.36132580041885375977f,
-    -0.35989505052566528320f,
-    -0.35846340656280517578f,
-    -0.35703095793724060059f,
-    -0.35559767484664916992f,
-    -0.35416352748870849609f,
-    -0.35272854566574096680f,
-    -0.35129275918006896973f,
-    -0.34985613822937011719f,
-    -0.34841868281364440918f,
-    -0.34698042273521423340f,
-    -0.34554132819175720215f,
-    -0.34410142898559570312f,
-    -0.34266072511672973633f,
-    -0.34121921658515930176f,
-    -0.33977687358856201172f,
-    -0.33833375573158264160f,
-    -0.33688986301422119141f,
-    -0.33544513583183288574f,
-    -0.33399966359138488770f,
-    -0.33255335688591003418f,
-    -0.33110630512237548828f,
-    -0.32965844869613647461f,
-    -0.32820984721183776855f,
-    -0.32676044106483459473f,
-    -0.32531028985977172852f,
-    -0.32385936379432678223f,
-    -0.32240769267082214355f,
-    -0.32095524668693542480f,
-    -0.31950202584266662598f,
-    -0.31804808974266052246f,
-    -0.31659337878227233887f,
-    -0.31513792276382446289f,
-    -0.31368175148963928223f,
-    -0.31222480535507202148f,
-    -0.31076714396476745605f,
-    -0.30930876731872558594f,
-    -0.30784964561462402344f,
-    -0.30638980865478515625f,
-    -0.30492922663688659668f,
-    -0.30346795916557312012f,
-    -0.30200594663619995117f,
-    -0.30054324865341186523f,
-    -0.29907983541488647461f,
-    -0.29761570692062377930f,
-    -0.29615089297294616699f,
-    -0.29468536376953125000f,
-    -0.29321914911270141602f,
-    -0.29175224900245666504f,
-    -0.29028466343879699707f,
-    -0.28881642222404479980f,
-    -0.28734746575355529785f,
-    -0.28587782382965087891f,
-    -0.28440752625465393066f,
-    -0.28293657302856445312f,
-    -0.28146493434906005859f,
-    -0.27999264001846313477f,
-    -0.27851969003677368164f,
-    -0.27704608440399169922f,
-    -0.27557182312011718750f,
-    -0.27409690618515014648f,
-    -0.27262136340141296387f,
-    -0.27114516496658325195f,
-    -0.26966831088066101074f,
-    -0.26819086074829101562f,
-    -0.26671275496482849121f,
-    -0.26523402333259582520f,
-    -0.26375466585159301758f,
-    -0.26227471232414245605f,
-    -0.26079410314559936523f,
-    -0.25931292772293090820f,
-    -0.25783109664916992188f,
-    -0.25634866952896118164f,
-    -0.25486564636230468750f,
-    -0.25338202714920043945f,
-    -0.25189781188964843750f,
-    -0.25041300058364868164f,
-    -0.24892760813236236572f,
-    -0.24744161963462829590f,
-    -0.24595504999160766602f,
-    -0.24446789920330047607f,
-    -0.24298018217086791992f,
-    -0.24149188399314880371f,
-    -0.24000301957130432129f,
-    -0.23851358890533447266f,
-    -0.23702360689640045166f,
-    -0.23553305864334106445f,
-    -0.23404195904731750488f,
-    -0.23255030810832977295f,
-    -0.23105810582637786865f,
-    -0.22956536710262298584f,
-    -0.22807207703590393066f,
-    -0.22657826542854309082f,
-    -0.22508391737937927246f,
-    -0.22358903288841247559f,
-    -0.22209362685680389404f,
-    -0.22059768438339233398f,
-    -0.21910123527050018311f,
-    -0.21760427951812744141f,
-    -0.21610680222511291504f,
-    -0.21460881829261779785f,
-    -0.21311031281948089600f,
-    -0.21161133050918579102f,
-    -0.21011184155941009521f,
-    -0.20861184597015380859f,
-    -0.20711137354373931885f,
-    -0.20561040937900543213f,
-    -0.20410896837711334229f,
-    -0.20260703563690185547f,
-    -0.20110464096069335938f,
-    -0.19960175454616546631f,
-    -0.19809840619564056396f,
-    -0.19659459590911865234f,
-    -0.19509032368659973145f,
-    -0.19358558952808380127f,
-    -0.19208039343357086182f,
-    -0.19057475030422210693f,
-    -0.18906866014003753662f,
-    -0.18756212294101715088f,
-    -0.18605515360832214355f,
-    -0.18454773724079132080f,
-    -0.18303988873958587646f,
-    -0.18153160810470581055f,
-    -0.18002289533615112305f,
-    -0.17851376533508300781f,
-    -0.17700421810150146484f,
-    -0.17549425363540649414f,
-    -0.17398387193679809570f,
-    -0.17247308790683746338f,
-    -0.17096188664436340332f,
-    -0.16945029795169830322f,
-    -0.16793829202651977539f,
-    -0.16642589867115020752f,
-    -0.16491311788558959961f,
-    -0.16339994966983795166f,
-    -0.16188639402389526367f,
-    -0.16037245094776153564f,
-    -0.15885815024375915527f,
-    -0.15734346210956573486f,
-    -0.15582840144634246826f,
-    -0.15431296825408935547f,
-    -0.15279719233512878418f,
-    -0.15128104388713836670f,
-    -0.14976453781127929688f,
-    -0.14824767410755157471f,
-    -0.14673046767711639404f,
-    -0.14521291851997375488f,
-    -0.14369502663612365723f,
-    -0.14217680692672729492f,
-    -0.14065824449062347412f,
-    -0.13913933932781219482f,
-    -0.13762012124061584473f,
-    -0.13610057532787322998f,
-    -0.13458070158958435059f,
-    -0.13306052982807159424f,
-    -0.13154003024101257324f,
-    -0.13001921772956848145f,
-    -0.12849810719490051270f,
-    -0.12697669863700866699f,
-    -0.12545497715473175049f,
-    -0.12393297255039215088f,
-    -0.12241067737340927124f,
-    -0.12088808417320251465f,
-    -0.11936521530151367188f,
-    -0.11784206330776214600f,
-    -0.11631862819194793701f,
-    -0.11479492485523223877f,
-    -0.11327095329761505127f,
-    -0.11174671351909637451f,
-    -0.11022220551967620850f,
-    -0.10869744420051574707f,
-    -0.10717242211103439331f,
-    -0.10564715415239334106f,
-    -0.10412163287401199341f,
-    -0.10259586572647094727f,
-    -0.10106986016035079956f,
-    -0.09954361617565155029f,
-    -0.09801714122295379639f,
-    -0.09649042785167694092f,
-    -0.09496349841356277466f,
-    -0.09343633800745010376f,
-    -0.09190895408391952515f,
-    -0.09038136154413223267f,
-    -0.08885355293750762939f,
-    -0.08732553571462631226f,
-    -0.08579730987548828125f,
-    -0.08426889032125473022f,
-    -0.08274026215076446533f,
-    -0.08121144771575927734f,
-    -0.07968243956565856934f,
-    -0.07815324515104293823f,
-    -0.07662386447191238403f,
-    -0.07509429752826690674f,
-    -0.07356456667184829712f,
-    -0.07203464955091476440f,
-    -0.07050457596778869629f,
-    -0.06897433102130889893f,
-    -0.06744392216205596924f,
-    -0.06591334939002990723f,
-    -0.06438262760639190674f,
-    -0.06285175681114196777f,
-    -0.06132073700428009033f,
-    -0.05978957191109657288f,
-    -0.05825826525688171387f,
-    -0.05672682076692581177f,
-    -0.05519524589180946350f,
-    -0.05366353690624237061f,
-    -0.05213170498609542847f,
-    -0.05059975013136863708f,
-    -0.04906767606735229492f,
-    -0.04753548279404640198f,
-    -0.04600318148732185364f,
-    -0.04447077214717864990f,
-    -0.04293825849890708923f,
-    -0.04140564054250717163f,
-    -0.03987292572855949402f,
-    -0.03834012150764465332f,
-    -0.03680722415447235107f,
-    -0.03527423739433288574f,
-    -0.03374117240309715271f,
-    -0.03220802545547485352f,
-    -0.03067480400204658508f,
-    -0.02914150804281234741f,
-    -0.02760814502835273743f,
-    -0.02607471868395805359f,
-    -0.02454122900962829590f,
-    -0.02300768159329891205f,
-    -0.02147408016026020050f,
-    -0.01994042843580245972f,
-    -0.01840673014521598816f,
-    -0.01687298715114593506f,
-    -0.01533920597285032272f,
-    -0.01380538847297430038f,
-    -0.01227153837680816650f,
-    -0.01073765940964221954f,
-    -0.00920375436544418335f,
-    -0.00766982883214950562f,
-    -0.00613588467240333557f,
-    -0.00460192607715725899f,
-    -0.00306795677170157433f,
-    -0.00153398013208061457f,
-    0.00000000000000000000f,
-    0.00153398013208061457f,
-    0.00306795677170157433f,
-    0.00460192607715725899f,
-    0.00613588467240333557f,
-    0.00766982883214950562f,
-    0.00920375436544418335f,
-    0.01073765940964221954f,
-    0.01227153837680816650f,
-    0.01380538847297430038f,
-    0.01533920597285032272f,
-    0.01687298715114593506f,
-    0.01840673014521598816f,
-    0.01994042843580245972f,
-    0.02147408016026020050f,
-    0.02300768159329891205f,
-    0.02454122900962829590f,
-    0.02607471868395805359f,
-    0.02760814502835273743f,
-    0.02914150804281234741f,
-    0.03067480400204658508f,
-    0.03220802545547485352f,
-    0.03374117240309715271f,
-    0.03527423739433288574f,
-    0.03680722415447235107f,
-    0.03834012150764465332f,
-    0.03987292572855949402f,
-    0.04140564054250717163f,
-    0.04293825849890708923f,
-    0.04447077214717864990f,
-    0.04600318148732185364f,
-    0.04753548279404640198f,
-    0.04906767606735229492f,
-    0.05059975013136863708f,
-    0.05213170498609542847f,
-    0.05366353690624237061f,
-    0.05519524589180946350f,
-    0.05672682076692581177f,
-    0.05825826525688171387f,
-    0.05978957191109657288f,
-    0.06132073700428009033f,
-    0.06285175681114196777f,
-    0.06438262760639190674f,
-    0.06591334939002990723f,
-    0.06744392216205596924f,
-    0.06897433102130889893f,
-    0.07050457596778869629f,
-    0.07203464955091476440f,
-    0.07356456667184829712f,
-    0.07509429752826690674f,
-    0.07662386447191238403f,
-    0.07815324515104293823f,
-    0.07968243956565856934f,
-    0.08121144771575927734f,
-    0.08274026215076446533f,
-    0.08426889032125473022f,
-    0.08579730987548828125f,
-    0.08732553571462631226f,
-    0.08885355293750762939f,
-    0.09038136154413223267f,
-    0.09190895408391952515f,
-    0.09343633800745010376f,
-    0.09496349841356277466f,
-    0.09649042785167694092f,
-    0.09801714122295379639f,
-    0.09954361617565155029f,
-    0.10106986016035079956f,
-    0.10259586572647094727f,
-    0.10412163287401199341f,
-    0.10564715415239334106f,
-    0.10717242211103439331f,
-    0.10869744420051574707f,
-    0.11022220551967620850f,
-    0.11174671351909637451f,
-    0.11327095329761505127f,
-    0.11479492485523223877f,
-    0.11631862819194793701f,
-    0.11784206330776214600f,
-    0.11936521530151367188f,
-    0.12088808417320251465f,
-    0.12241067737340927124f,
-    0.12393297255039215088f,
-    0.12545497715473175049f,
-    0.12697669863700866699f,
-    0.12849810719490051270f,
-    0.13001921772956848145f,
-    0.13154003024101257324f,
-    0.13306052982807159424f,
-    0.13458070158958435059f,
-    0.13610057532787322998f,
-    0.13762012124061584473f,
-    0.13913933932781219482f,
-    0.14065824449062347412f,
-    0.14217680692672729492f,
-    0.14369502663612365723f,
-    0.14521291851997375488f,
-    0.14673046767711639404f,
-    0.14824767410755157471f,
-    0.14976453781127929688f,
-    0.15128104388713836670f,
-    0.15279719233512878418f,
-    0.15431296825408935547f,
-    0.15582840144634246826f,
-    0.15734346210956573486f,
-    0.15885815024375915527f,
-    0.16037245094776153564f,
-    0.16188639402389526367f,
-    0.16339994966983795166f,
-    0.16491311788558959961f,
-    0.16642589867115020752f,
-    0.16793829202651977539f,
-    0.16945029795169830322f,
-    0.17096188664436340332f,
-    0.17247308790683746338f,
-    0.17398387193679809570f,
-    0.17549425363540649414f,
-    0.17700421810150146484f,
-    0.17851376533508300781f,
-    0.18002289533615112305f,
-    0.18153160810470581055f,
-    0.18303988873958587646f,
-    0.18454773724079132080f,
-    0.18605515360832214355f,
-    0.18756212294101715088f,
-    0.18906866014003753662f,
-    0.19057475030422210693f,
-    0.19208039343357086182f,
-    0.19358558952808380127f,
-    0.19509032368659973145f,
-    0.19659459590911865234f,
-    0.19809840619564056396f,
-    0.19960175454616546631f,
-    0.20110464096069335938f,
-    0.20260703563690185547f,
-    0.20410896837711334229f,
-    0.20561040937900543213f,
-    0.20711137354373931885f,
-    0.20861184597015380859f,
-    0.21011184155941009521f,
-    0.21161133050918579102f,
-    0.21311031281948089600f,
-    0.21460881829261779785f,
-    0.21610680222511291504f,
-    0.21760427951812744141f,
-    0.21910123527050018311f,
-    0.22059768438339233398f,
-    0.22209362685680389404f,
-    0.22358903288841247559f,
-    0.22508391737937927246f,
-    0.22657826542854309082f,
-    0.22807207703590393066f,
-    0.22956536710262298584f,
-    0.23105810582637786865f,
-    0.23255030810832977295f,
-    0.23404195904731750488f,
-    0.23553305864334106445f,
-    0.23702360689640045166f,
-    0.23851358890533447266f,
-    0.24000301957130432129f,
-    0.24149188399314880371f,
-    0.24298018217086791992f,
-    0.24446789920330047607f,
-    0.24595504999160766602f,
-    0.24744161963462829590f,
-    0.24892760813236236572f,
-    0.25041300058364868164f,
-    0.25189781188964843750f,
-    0.25338202714920043945f,
-    0.25486564636230468750f,
-    0.25634866952896118164f,
-    0.25783109664916992188f,
-    0.25931292772293090820f,
-    0.26079410314559936523f,
-    0.26227471232414245605f,
-    0.26375466585159301758f,
-    0.26523402333259582520f,
-    0.26671275496482849121f,
-    0.26819086074829101562f,
-    0.26966831088066101074f,
-    0.27114516496658325195f,
-    0.27262136340141296387f,
-    0.27409690618515014648f,
-    0.27557182312011718750f,
-    0.27704608440399169922f,
-    0.27851969003677368164f,
-    0.27999264001846313477f,
-    0.28146493434906005859f,
-    0.28293657302856445312f,
-    0.28440752625465393066f,
-    0.28587782382965087891f,
-    0.28734746575355529785f,
-    0.28881642222404479980f,
-    0.29028466343879699707f,
-    0.29175224900245666504f,
-    0.29321914911270141602f,
-    0.29468536376953125000f,
-    0.29615089297294616699f,
-    0.29761570692062377930f,
-    0.29907983541488647461f,
-    0.30054324865341186523f,
-    0.30200594663619995117f,
-    0.30346795916557312012f,
-    0.30492922663688659668f,
-    0.30638980865478515625f,
-    0.30784964561462402344f,
-    0.30930876731872558594f,
-    0.31076714396476745605f,
-    0.31222480535507202148f,
-    0.31368175148963928223f,
-    0.31513792276382446289f,
-    0.31659337878227233887f,
-    0.31804808974266052246f,
-    0.31950202584266662598f,
-    0.32095524668693542480f,
-    0.32240769267082214355f,
-    0.32385936379432678223f,
-    0.32531028985977172852f,
-    0.32676044106483459473f,
-    0.32820984721183776855f,
-    0.32965844869613647461f,
-    0.33110630512237548828f,
-    0.33255335688591003418f,
-    0.33399966359138488770f,
-    0.33544513583183288574f,
-    0.33688986301422119141f,
-    0.33833375573158264160f,
-    0.33977687358856201172f,
-    0.34121921658515930176f,
-    0.34266072511672973633f,
-    0.34410142898559570312f,
-    0.34554132819175720215f,
-    0.34698042273521423340f,
-    0.34841868281364440918f,
-    0.34985613822937011719f,
-    0.35129275918006896973f,
-    0.35272854566574096680f,
-    0.35416352748870849609f,
-    0.35559767484664916992f,
-    0.35703095793724060059f,
-    0.35846340656280517578f,
-    0.35989505052566528320f,
-    0.36132580041885375977f,
-    0.36275571584701538086f,
-    0.36418479681015014648f,
-    0.36561298370361328125f,
-    0.36704033613204956055f,
-    0.36846682429313659668f,
-    0.36989244818687438965f,
-    0.37131720781326293945f,
-    0.37274107336997985840f,
-    0.37416407465934753418f,
-    0.37558618187904357910f,
-    0.37700742483139038086f,
-    0.37842774391174316406f,
-    0.37984719872474670410f,
-    0.38126575946807861328f,
-    0.38268342614173889160f,
-    0.38410019874572753906f,
-    0.38551604747772216797f,
-    0.38693100214004516602f,
-    0.38834503293037414551f,
-    0.38975816965103149414f,
-    0.39117038249969482422f,
-    0.39258167147636413574f,
-    0.39399203658103942871f,
-    0.39540147781372070312f,
-    0.39680999517440795898f,
-    0.39821755886077880859f,
-    0.39962419867515563965f,
-    0.40102988481521606445f,
-    0.40243464708328247070f,
-    0.40383845567703247070f,
-    0.40524131059646606445f,
-    0.40664321184158325195f,
-    0.40804415941238403320f,
-    0.40944415330886840820f,
-    0.41084316372871398926f,
-    0.41224122047424316406f,
-    0.41363832354545593262f,
-    0.41503441333770751953f,
-    0.41642954945564270020f,
-    0.41782370209693908691f,
-    0.41921690106391906738f,
-    0.42060908675193786621f,
-    0.42200025916099548340f,
-    0.42339047789573669434f,
-    0.42477968335151672363f,
-    0.42616787552833557129f,
-    0.42755508422851562500f,
-    0.42894127964973449707f,
-    0.43032649159431457520f,
-    0.43171066045761108398f,
-    0.43309381604194641113f,
-    0.43447595834732055664f,
-    0.43585708737373352051f,
-    0.43723717331886291504f,
-    0.43861624598503112793f,
-    0.43999427556991577148f,
-    0.44137126207351684570f,
-    0.44274723529815673828f,
-    0.44412213563919067383f,
-    0.44549602270126342773f,
-    0.44686883687973022461f,
-    0.44824060797691345215f,
-    0.44961133599281311035f,
-    0.45098099112510681152f,
-    0.45234957337379455566f,
-    0.45371711254119873047f,
-    0.45508357882499694824f,
-    0.45644897222518920898f,
-    0.45781329274177551270f,
-    0.45917654037475585938f,
-    0.46053871512413024902f,
-    0.46189978718757629395f,
-    0.46325978636741638184f,
-    0.46461868286132812500f,
-    0.46597650647163391113f,
-    0.46733319759368896484f,
-    0.46868881583213806152f,
-    0.47004333138465881348f,
-    0.47139674425125122070f,
-    0.47274902462959289551f,
-    0.47410020232200622559f,
-    0.47545027732849121094f,
-    0.47679921984672546387f,
-    0.47814705967903137207f,
-    0.47949376702308654785f,
-    0.48083934187889099121f,
-    0.48218378424644470215f,
-    0.48352706432342529297f,
-    0.48486924171447753906f,
-    0.48621028661727905273f,
-    0.48755016922950744629f,
-    0.48888888955116271973f,
-    0.49022647738456726074f,
-    0.49156290292739868164f,
-    0.49289819598197937012f,
-    0.49423229694366455078f,
-    0.49556526541709899902f,
-    0.49689704179763793945f,
-    0.49822765588760375977f,
-    0.49955710768699645996f,
-    0.50088536739349365234f,
-    0.50221246480941772461f,
-    0.50353837013244628906f,
-    0.50486308336257934570f,
-    0.50618666410446166992f,
-    0.50750899314880371094f,
-    0.50883013010025024414f,
-    0.51015007495880126953f,
-    0.51146882772445678711f,
-    0.51278638839721679688f,
-    0.51410275697708129883f,
-    0.51541787385940551758f,
-    0.51673179864883422852f,
-    0.51804453134536743164f,
-    0.51935601234436035156f,
-    0.52066624164581298828f,
-    0.52197527885437011719f,
-    0.52328312397003173828f,
-    0.52458965778350830078f,
-    0.52589499950408935547f,
-    0.52719914913177490234f,
-    0.52850198745727539062f,
-    0.52980363368988037109f,
-    0.53110402822494506836f,
-    0.53240311145782470703f,
-    0.53370100259780883789f,
-    0.53499764204025268555f,
-    0.53629297018051147461f,
-    0.53758704662322998047f,
-    0.53887993097305297852f,
-    0.54017144441604614258f,
-    0.54146176576614379883f,
-    0.54275077581405639648f,
-    0.54403853416442871094f,
-    0.54532498121261596680f,
-    0.54661017656326293945f,
-    0.54789406061172485352f,
-    0.54917663335800170898f,
-    0.55045795440673828125f,
-    0.55173796415328979492f,
-    0.55301672220230102539f,
-    0.55429410934448242188f,
-    0.55557024478912353516f,
-    0.55684500932693481445f,
-    0.55811852216720581055f,
-    0.55939072370529174805f,
-    0.56066155433654785156f,
-    0.56193113327026367188f,
-    0.56319934129714965820f,
-    0.56446623802185058594f,
-    0.56573182344436645508f,
-    0.56699603796005249023f,
-    0.56825894117355346680f,
-    0.56952053308486938477f,
-    0.57078075408935546875f,
-    0.57203960418701171875f,
-    0.57329714298248291016f,
-    0.57455337047576904297f,
-    0.57580816745758056641f,
-    0.57706165313720703125f,
-    0.57831376791000366211f,
-    0.57956457138061523438f,
-    0.58081394433975219727f,
-    0.58206200599670410156f,
-    0.58330863714218139648f,
-    0.58455395698547363281f,
-    0.58579784631729125977f,
-    0.58704036474227905273f,
-    0.58828157186508178711f,
-    0.58952128887176513672f,
-    0.59075969457626342773f,
-    0.59199666976928710938f,
-    0.59323227405548095703f,
-    0.59446650743484497070f,
-    0.59569931030273437500f,
-    0.59693068265914916992f,
-    0.59816068410873413086f,
-    0.59938931465148925781f,
-    0.60061645507812500000f,
-    0.60184222459793090820f,
-    0.60306662321090698242f,
-    0.60428953170776367188f,
-    0.60551106929779052734f,
-    0.60673111677169799805f,
-    0.60794979333877563477f,
-    0.60916703939437866211f,
-    0.61038279533386230469f,
-    0.61159718036651611328f,
-    0.61281007528305053711f,
-    0.61402153968811035156f,
-    0.61523157358169555664f,
-    0.61644017696380615234f,
-    0.61764729022979736328f,
-    0.61885297298431396484f,
-    0.62005722522735595703f,
-    0.62125998735427856445f,
-    0.62246125936508178711f,
-    0.62366110086441040039f,
-    0.62485951185226440430f,
-    0.62605637311935424805f,
-    0.62725180387496948242f,
-    0.62844574451446533203f,
-    0.62963825464248657227f,
-    0.63082921504974365234f,
-    0.63201874494552612305f,
-    0.63320678472518920898f,
-    0.63439327478408813477f,
-    0.63557833433151245117f,
-    0.63676184415817260742f,
-    0.63794392347335815430f,
-    0.63912445306777954102f,
-    0.64030349254608154297f,
-    0.64148104190826416016f,
-    0.64265704154968261719f,
-    0.64383155107498168945f,
-    0.64500451087951660156f,
-    0.64617604017257690430f,
-    0.64734596014022827148f,
-    0.64851438999176025391f,
-    0.64968132972717285156f,
-    0.65084666013717651367f,
-    0.65201056003570556641f,
-    0.65317285060882568359f,
-    0.65433359146118164062f,
-    0.65549284219741821289f,
-    0.65665054321289062500f,
-    0.65780669450759887695f,
-    0.65896129608154296875f,
-    0.66011434793472290039f,
-    0.66126585006713867188f,
-    0.66241580247879028320f,
-    0.66356414556503295898f,
-    0.66471099853515625000f,
-    0.66585624217987060547f,
-    0.66699993610382080078f,
-    0.66814202070236206055f,
-    0.66928261518478393555f,
-    0.67042154073715209961f,
-    0.67155897617340087891f,
-    0.67269474267959594727f,
-    0.67382901906967163086f,
-    0.67496162652969360352f,
-    0.67609268426895141602f,
-    0.67722219228744506836f,
-    0.67835003137588500977f,
-    0.67947632074356079102f,
-    0.68060100078582763672f,
-    0.68172407150268554688f,
-    0.68284553289413452148f,
-    0.68396538496017456055f,
-    0.68508368730545043945f,
-    0.68620032072067260742f,
-    0.68731534481048583984f,
-    0.68842875957489013672f,
-    0.68954056501388549805f,
-    0.69065070152282714844f,
-    0.69175922870635986328f,
-    0.69286614656448364258f,
-    0.69397145509719848633f,
-    0.69507509469985961914f,
-    0.69617712497711181641f,
-    0.69727748632431030273f,
-    0.69837623834609985352f,
-    0.69947332143783569336f,
-    0.70056879520416259766f,
-    0.70166260004043579102f,
-    0.70275473594665527344f,
-    0.70384526252746582031f,
-    0.70493406057357788086f,
-    0.70602124929428100586f,
-    0.70710676908493041992f,
-    0.70819061994552612305f,
-    0.70927280187606811523f,
-    0.71035337448120117188f,
-    0.71143221855163574219f,
-    0.71250939369201660156f,
-    0.71358484029769897461f,
-    0.71465867757797241211f,
-    0.71573084592819213867f,
-    0.71680128574371337891f,
-    0.71787005662918090820f,
-    0.71893709897994995117f,
-    0.72000253200531005859f,
-    0.72106617689132690430f,
-    0.72212821245193481445f,
-    0.72318845987319946289f,
-    0.72424709796905517578f,
-    0.72530394792556762695f,
-    0.72635912895202636719f,
-    0.72741264104843139648f,
-    0.72846436500549316406f,
-    0.72951442003250122070f,
-    0.73056274652481079102f,
-    0.73160940408706665039f,
-    0.73265427350997924805f,
-    0.73369741439819335938f,
-    0.73473888635635375977f,
-    0.73577857017517089844f,
-    0.73681658506393432617f,
-    0.73785281181335449219f,
-    0.73888731002807617188f,
-    0.73992007970809936523f,
-    0.74095112085342407227f,
-    0.74198043346405029297f,
-    0.74300795793533325195f,
-    0.74403375387191772461f,
-    0.74505776166915893555f,
-    0.74608010053634643555f,
-    0.74710059165954589844f,
-    0.74811935424804687500f,
-    0.74913638830184936523f,
-    0.75015163421630859375f,
-    0.75116515159606933594f,
-    0.75217682123184204102f,
-    0.75318682193756103516f,
-    0.75419497489929199219f,
-    0.75520139932632446289f,
-    0.75620597600936889648f,
-    0.75720882415771484375f,
-    0.75820988416671752930f,
-    0.75920921564102172852f,
-    0.76020669937133789062f,
-    0.76120239496231079102f,
-    0.76219630241394042969f,
-    0.76318842172622680664f,
-    0.76417875289916992188f,
-    0.76516723632812500000f,
-    0.76615399122238159180f,
-    0.76713889837265014648f,
-    0.76812201738357543945f,
-    0.76910334825515747070f,
-    0.77008283138275146484f,
-    0.77106052637100219727f,
-    0.77203637361526489258f,
-    0.77301043272018432617f,
-    0.77398270368576049805f,
-    0.77495312690734863281f,
-    0.77592170238494873047f,
-    0.77688848972320556641f,
-    0.77785342931747436523f,
-    0.77881652116775512695f,
-    0.77977776527404785156f,
-    0.78073722124099731445f,
-    0.78169482946395874023f,
-    0.78265058994293212891f,
-    0.78360450267791748047f,
-    0.78455656766891479492f,
-    0.78550684452056884766f,
-    0.78645521402359008789f,
-    0.78740173578262329102f,
-    0.78834640979766845703f,
-    0.78928923606872558594f,
-    0.79023021459579467773f,
-    0.79116934537887573242f,
-    0.79210656881332397461f,
-    0.79304194450378417969f,
-    0.79397547245025634766f,
-    0.79490715265274047852f,
-    0.79583692550659179688f,
-    0.79676479101181030273f,
-    0.79769086837768554688f,
-    0.79861497879028320312f,
-    0.79953724145889282227f,
-    0.80045765638351440430f,
-    0.80137616395950317383f,
-    0.80229282379150390625f,
-    0.80320751667022705078f,
-    0.80412036180496215820f,
-    0.80503135919570922852f,
-    0.80594038963317871094f,
-    0.80684757232666015625f,
-    0.80775284767150878906f,
-    0.80865615606307983398f,
-    0.80955761671066284180f,
-    0.81045717000961303711f,
-    0.81135487556457519531f,
-    0.81225061416625976562f,
-    0.81314438581466674805f,
-    0.81403630971908569336f,
-    0.81492632627487182617f,
-    0.81581443548202514648f,
-    0.81670057773590087891f,
-    0.81758481264114379883f,
-    0.81846714019775390625f,
-    0.81934750080108642578f,
-    0.82022595405578613281f,
-    0.82110249996185302734f,
-    0.82197713851928710938f,
-    0.82284981012344360352f,
-    0.82372051477432250977f,
-    0.82458931207656860352f,
-    0.82545614242553710938f,
-    0.82632106542587280273f,
-    0.82718402147293090820f,
-    0.82804507017135620117f,
-    0.82890409231185913086f,
-    0.82976120710372924805f,
-    0.83061641454696655273f,
-    0.83146959543228149414f,
-    0.83232086896896362305f,
-    0.83317017555236816406f,
-    0.83401751518249511719f,
-    0.83486288785934448242f,
-    0.83570629358291625977f,
-    0.83654773235321044922f,
-    0.83738720417022705078f,
-    0.83822470903396606445f,
-    0.83906024694442749023f,
-    0.83989381790161132812f,
-    0.84072536230087280273f,
-    0.84155499935150146484f,
-    0.84238260984420776367f,
-    0.84320825338363647461f,
-    0.84403187036514282227f,
-    0.84485357999801635742f,
-    0.84567326307296752930f,
-    0.84649091958999633789f,
-    0.84730660915374755859f,
-    0.84812033176422119141f,
-    0.84893202781677246094f,
-    0.84974175691604614258f,
-    0.85054945945739746094f,
-    0.85135519504547119141f,
-    0.85215890407562255859f,
-    0.85296058654785156250f,
-    0.85376030206680297852f,
-    0.85455799102783203125f,
-    0.85535365343093872070f,
-    0.85614734888076782227f,
-    0.85693895816802978516f,
-    0.85772860050201416016f,
-    0.85851621627807617188f,
-    0.85930180549621582031f,
-    0.86008536815643310547f,
-    0.86086696386337280273f,
-    0.86164647340774536133f,
-    0.86242395639419555664f,
-    0.86319941282272338867f,
-    0.86397284269332885742f,
-    0.86474424600601196289f,
-    0.86551362276077270508f,
-    0.86628097295761108398f,
-    0.86704623699188232422f,
-    0.86780947446823120117f,
-    0.86857068538665771484f,
-    0.86932986974716186523f,
-    0.87008696794509887695f,
-    0.87084203958511352539f,
-    0.87159508466720581055f,
-    0.87234604358673095703f,
-    0.87309497594833374023f,
-    0.87384182214736938477f,
-    0.87458664178848266602f,
-    0.87532937526702880859f,
-    0.87607008218765258789f,
-    0.87680870294570922852f,
-    0.87754529714584350586f,
-    0.87827980518341064453f,
-    0.87901222705841064453f,
-    0.87974262237548828125f,
-    0.88047087192535400391f,
-    0.88119709491729736328f,
-    0.88192129135131835938f,
-    0.88264334201812744141f,
-    0.88336336612701416016f,
-    0.88408124446868896484f,
-    0.88479709625244140625f,
-    0.88551086187362670898f,
-    0.88622254133224487305f,
-    0.88693213462829589844f,
-    0.88763964176177978516f,
-    0.88834506273269653320f,
-    0.88904833793640136719f,
-    0.88974958658218383789f,
-    0.89044874906539916992f,
-    0.89114576578140258789f,
-    0.89184069633483886719f,
-    0.89253354072570800781f,
-    0.89322429895401000977f,
-    0.89391297101974487305f,
-    0.89459949731826782227f,
-    0.89528393745422363281f,
-    0.89596623182296752930f,
-    0.89664649963378906250f,
-    0.89732456207275390625f,
-    0.89800059795379638672f,
-    0.89867448806762695312f,
-    0.89934623241424560547f,
-    0.90001589059829711914f,
-    0.90068340301513671875f,
-    0.90134882926940917969f,
-    0.90201216936111450195f,
-    0.90267330408096313477f,
-    0.90333235263824462891f,
-    0.90398931503295898438f,
-    0.90464407205581665039f,
-    0.90529674291610717773f,
-    0.90594726800918579102f,
-    0.90659570693969726562f,
-    0.90724200010299682617f,
-    0.90788608789443969727f,
-    0.90852808952331542969f,
-    0.90916800498962402344f,
-    0.90980571508407592773f,
-    0.91044127941131591797f,
-    0.91107475757598876953f,
-    0.91170603036880493164f,
-    0.91233515739440917969f,
-    0.91296219825744628906f,
-    0.91358703374862670898f,
-    0.91420978307723999023f,
-    0.91483032703399658203f,
-    0.91544872522354125977f,
-    0.91606497764587402344f,
-    0.91667908430099487305f,
-    0.91729098558425903320f,
-    0.91790080070495605469f,
-    0.91850841045379638672f,
-    0.91911387443542480469f,
-    0.91971713304519653320f,
-    0.92031830549240112305f,
-    0.92091721296310424805f,
-    0.92151403427124023438f,
-    0.92210865020751953125f,
-    0.92270112037658691406f,
-    0.92329144477844238281f,
-    0.92387950420379638672f,
-    0.92446547746658325195f,
-    0.92504924535751342773f,
-    0.92563080787658691406f,
-    0.92621022462844848633f,
-    0.92678749561309814453f,
-    0.92736250162124633789f,
-    0.92793542146682739258f,
-    0.92850607633590698242f,
-    0.92907458543777465820f,
-    0.92964088916778564453f,
-    0.93020504713058471680f,
-    0.93076694011688232422f,
-    0.93132668733596801758f,
-    0.93188428878784179688f,
-    0.93243962526321411133f,
-    0.93299281597137451172f,
-    0.93354380130767822266f,
-    0.93409252166748046875f,
-    0.93463915586471557617f,
-    0.93518352508544921875f,
-    0.93572568893432617188f,
-    0.93626564741134643555f,
-    0.93680346012115478516f,
-    0.93733900785446166992f,
-    0.93787235021591186523f,
-    0.93840354681015014648f,
-    0.93893247842788696289f,
-    0.93945920467376708984f,
-    0.93998372554779052734f,
-    0.94050604104995727539f,
-    0.94102615118026733398f,
-    0.94154405593872070312f,
-    0.94205975532531738281f,
-    0.94257318973541259766f,
-    0.94308441877365112305f,
-    0.94359344244003295898f,
-    0.94410026073455810547f,
-    0.94460481405258178711f,
-    0.94510722160339355469f,
-    0.94560730457305908203f,
-    0.94610524177551269531f,
-    0.94660091400146484375f,
-    0.94709438085556030273f,
-    0.94758558273315429688f,
-    0.94807457923889160156f,
-    0.94856137037277221680f,
-    0.94904589653015136719f,
-    0.94952815771102905273f,
-    0.95000827312469482422f,
-    0.95048606395721435547f,
-    0.95096164941787719727f,
-    0.95143502950668334961f,
-    0.95190614461898803711f,
-    0.95237499475479125977f,
-    0.95284163951873779297f,
-    0.95330601930618286133f,
-    0.95376819372177124023f,
-    0.95422810316085815430f,
-    0.95468574762344360352f,
-    0.95514118671417236328f,
-    0.95559436082839965820f,
-    0.95604526996612548828f,
-    0.95649391412734985352f,
-    0.95694035291671752930f,
-    0.95738452672958374023f,
-    0.95782643556594848633f,
-    0.95826607942581176758f,
-    0.95870345830917358398f,
-    0.95913863182067871094f,
-    0.95957154035568237305f,
-    0.96000212430953979492f,
-    0.96043050289154052734f,
-    0.96085661649703979492f,
-    0.96128046512603759766f,
-    0.96170204877853393555f,
-    0.96212142705917358398f,
-    0.96253848075866699219f,
-    0.96295326948165893555f,
-    0.96336579322814941406f,
-    0.96377605199813842773f,
-    0.96418404579162597656f,
-    0.96458977460861206055f,
-    0.96499323844909667969f,
-    0.96539443731307983398f,
-    0.96579337120056152344f,
-    0.96618998050689697266f,
-    0.96658438444137573242f,
-    0.96697646379470825195f,
-    0.96736627817153930664f,
-    0.96775382757186889648f,
-    0.96813911199569702148f,
-    0.96852207183837890625f,
-    0.96890282630920410156f,
-    0.96928125619888305664f,
-    0.96965736150741577148f,
-    0.97003126144409179688f,
-    0.97040283679962158203f,
-    0.97077214717864990234f,
-    0.97113913297653198242f,
-    0.97150391340255737305f,
-    0.97186630964279174805f,
-    0.97222650051116943359f,
-    0.97258436679840087891f,
-    0.97293996810913085938f,
-    0.97329324483871459961f,
-    0.97364425659179687500f,
-    0.97399294376373291016f,
-    0.97433936595916748047f,
-    0.97468352317810058594f,
-    0.97502535581588745117f,
-    0.97536486387252807617f,
-    0.97570210695266723633f,
-    0.97603708505630493164f,
-    0.97636973857879638672f,
-    0.97670006752014160156f,
-    0.97702813148498535156f,
-    0.97735387086868286133f,
-    0.97767734527587890625f,
-    0.97799849510192871094f,
-    0.97831737995147705078f,
-    0.97863394021987915039f,
-    0.97894817590713500977f,
-    0.97926014661788940430f,
-    0.97956979274749755859f,
-    0.97987711429595947266f,
-    0.98018211126327514648f,
-    0.98048484325408935547f,
-    0.98078525066375732422f,
-    0.98108339309692382812f,
-    0.98137921094894409180f,
-    0.98167270421981811523f,
-    0.98196387290954589844f,
-    0.98225271701812744141f,
-    0.98253929615020751953f,
-    0.98282355070114135742f,
-    0.98310548067092895508f,
-    0.98338508605957031250f,
-    0.98366242647171020508f,
-    0.98393744230270385742f,
-    0.98421007394790649414f,
-    0.98448044061660766602f,
-    0.98474848270416259766f,
-    0.98501425981521606445f,
-    0.98527765274047851562f,
-    0.98553872108459472656f,
-    0.98579752445220947266f,
-    0.98605394363403320312f,
-    0.98630809783935546875f,
-    0.98655992746353149414f,
-    0.98680937290191650391f,
-    0.98705655336380004883f,
-    0.98730140924453735352f,
-    0.98754394054412841797f,
-    0.98778414726257324219f,
-    0.98802202939987182617f,
-    0.98825758695602416992f,
-    0.98849081993103027344f,
-    0.98872166872024536133f,
-    0.98895025253295898438f,
-    0.98917651176452636719f,
-    0.98940044641494750977f,
-    0.98962199687957763672f,
-    0.98984128236770629883f,
-    0.99005818367004394531f,
-    0.99027281999588012695f,
-    0.99048507213592529297f,
-    0.99069499969482421875f,
-    0.99090266227722167969f,
-    0.99110794067382812500f,
-    0.99131083488464355469f,
-    0.99151146411895751953f,
-    0.99170976877212524414f,
-    0.99190568923950195312f,
-    0.99209928512573242188f,
-    0.99229061603546142578f,
-    0.99247956275939941406f,
-    0.99266612529754638672f,
-    0.99285042285919189453f,
-    0.99303233623504638672f,
-    0.99321192502975463867f,
-    0.99338918924331665039f,
-    0.99356412887573242188f,
-    0.99373674392700195312f,
-    0.99390697479248046875f,
-    0.99407488107681274414f,
-    0.99424046277999877930f,
-    0.99440366029739379883f,
-    0.99456459283828735352f,
-    0.99472314119338989258f,
-    0.99487930536270141602f,
-    0.99503320455551147461f,
-    0.99518471956253051758f,
-    0.99533390998840332031f,
-    0.99548077583312988281f,
-    0.99562525749206542969f,
-    0.99576741456985473633f,
-    0.99590724706649780273f,
-    0.99604469537734985352f,
-    0.99617981910705566406f,
-    0.99631261825561523438f,
-    0.99644303321838378906f,
-    0.99657112360000610352f,
-    0.99669688940048217773f,
-    0.99682027101516723633f,
-    0.99694132804870605469f,
-    0.99706006050109863281f,
-    0.99717640876770019531f,
-    0.99729043245315551758f,
-    0.99740213155746459961f,
-    0.99751144647598266602f,
-    0.99761843681335449219f,
-    0.99772304296493530273f,
-    0.99782532453536987305f,
-    0.99792528152465820312f,
-    0.99802285432815551758f,
-    0.99811810255050659180f,
-    0.99821102619171142578f,
-    0.99830156564712524414f,
-    0.99838972091674804688f,
-    0.99847555160522460938f,
-    0.99855905771255493164f,
-    0.99864023923873901367f,
-    0.99871903657913208008f,
-    0.99879544973373413086f,
-    0.99886953830718994141f,
-    0.99894130229949951172f,
-    0.99901068210601806641f,
-    0.99907773733139038086f,
-    0.99914240837097167969f,
-    0.99920475482940673828f,
-    0.99926477670669555664f,
-    0.99932235479354858398f,
-    0.99937766790390014648f,
-    0.99943059682846069336f,
-    0.99948120117187500000f,
-    0.99952942132949829102f,
-    0.99957531690597534180f,
-    0.99961882829666137695f,
-    0.99966001510620117188f,
-    0.99969881772994995117f,
-    0.99973529577255249023f,
-    0.99976938962936401367f,
-    0.99980115890502929688f,
-    0.99983060359954833984f,
-    0.99985766410827636719f,
-    0.99988234043121337891f,
-    0.99990469217300415039f,
-    0.99992471933364868164f,
-    0.99994236230850219727f,
-    0.99995762109756469727f,
-    0.99997061491012573242f,
-    0.99998116493225097656f,
-    0.99998939037322998047f,
-    0.99999529123306274414f,
-    0.99999880790710449219f,
-};
+#include "math_util.h"
 
-// atan lookup table
-s16 D_8038B000[1025] = {
-       0,
-      10,
-      20,
-      31,
-      41,
-      51,
-      61,
-      71,
-      81,
-      92,
-     102,
-     112,
-     122,
-     132,
-     143,
-     153,
-     163,
-     173,
-     183,
-     194,
-     204,
-     214,
-     224,
-     234,
-     244,
-     255,
-     265,
-     275,
-     285,
-     295,
-     305,
-     316,
-     326,
-     336,
-     346,
-     356,
-     367,
-     377,
-     387,
-     397,
-     407,
-     417,
-     428,
-     438,
-     448,
-     458,
-     468,
-     478,
-     489,
-     499,
-     509,
-     519,
-     529,
-     539,
-     550,
-     560,
-     570,
-     580,
-     590,
-     600,
-     610,
-     621,
-     631,
-     641,
-     651,
-     661,
-     671,
-     681,
-     692,
-     702,
-     712,
-     722,
-     732,
-     742,
-     752,
-     763,
-     773,
-     783,
-     793,
-     803,
-     813,
-     823,
-     833,
-     844,
-     854,
-     864,
-     874,
-     884,
-     894,
-     904,
-     914,
-     924,
-     935,
-     945,
-     955,
-     965,
-     975,
-     985,
-     995,
-    1005,
-    1015,
-    1025,
-    1036,
-    1046,
-    1056,
-    1066,
-    1076,
-    1086,
-    1096,
-    1106,
-    1116,
-    1126,
-    1136,
-    1146,
-    1156,
-    1166,
-    1177,
-    1187,
-    1197,
-    1207,
-    1217,
-    1227,
-    1237,
-    1247,
-    1257,
-    1267,
-    1277,
-    1287,
-    1297,
-    1307,
-    1317,
-    1327,
-    1337,
-    1347,
-    1357,
-    1367,
-    1377,
-    1387,
-    1397,
-    1407,
-    1417,
-    1427,
-    1437,
-    1447,
-    1457,
-    1467,
-    1477,
-    1487,
-    1497,
-    1507,
-    1517,
-    1527,
-    1537,
-    1547,
-    1557,
-    1567,
-    1577,
-    1587,
-    1597,
-    1607,
-    1617,
-    1627,
-    1637,
-    1646,
-    1656,
-    1666,
-    1676,
-    1686,
-    1696,
-    1706,
-    1716,
-    1726,
-    1736,
-    1746,
-    1756,
-    1765,
-    1775,
-    1785,
-    1795,
-    1805,
-    1815,
-    1825,
-    1835,
-    1845,
-    1854,
-    1864,
-    1874,
-    1884,
-    1894,
-    1904,
-    1914,
-    1923,
-    1933,
-    1943,
-    1953,
-    1963,
-    1973,
-    1982,
-    1992,
-    2002,
-    2012,
-    2022,
-    2031,
-    2041,
-    2051,
-    2061,
-    2071,
-    2080,
-    2090,
-    2100,
-    2110,
-    2120,
-    2129,
-    2139,
-    2149,
-    2159,
-    2168,
-    2178,
-    2188,
-    2198,
-    2207,
-    2217,
-    2227,
-    2237,
-    2246,
-    2256,
-    2266,
-    2275,
-    2285,
-    2295,
-    2305,
-    2314,
-    2324,
-    2334,
-    2343,
-    2353,
-    2363,
-    2372,
-    2382,
-    2392,
-    2401,
-    2411,
-    2421,
-    2430,
-    2440,
-    2450,
-    2459,
-    2469,
-    2478,
-    2488,
-    2498,
-    2507,
-    2517,
-    2526,
-    2536,
-    2546,
-    2555,
-    2565,
-    2574,
-    2584,
-    2594,
-    2603,
-    2613,
-    2622,
-    2632,
-    2641,
-    2651,
-    2660,
-    2670,
-    2679,
-    2689,
-    2699,
-    2708,
-    2718,
-    2727,
-    2737,
-    2746,
-    2756,
-    2765,
-    2775,
-    2784,
-    2793,
-    2803,
-    2812,
-    2822,
-    2831,
-    2841,
-    2850,
-    2860,
-    2869,
-    2879,
-    2888,
-    2897,
-    2907,
-    2916,
-    2926,
-    2935,
-    2944,
-    2954,
-    2963,
-    2973,
-    2982,
-    2991,
-    3001,
-    3010,
-    3019,
-    3029,
-    3038,
-    3047,
-    3057,
-    3066,
-    3075,
-    3085,
-    3094,
-    3103,
-    3113,
-    3122,
-    3131,
-    3141,
-    3150,
-    3159,
-    3168,
-    3178,
-    3187,
-    3196,
-    3206,
-    3215,
-    3224,
-    3233,
-    3243,
-    3252,
-    3261,
-    3270,
-    3279,
-    3289,
-    3298,
-    3307,
-    3316,
-    3325,
-    3335,
-    3344,
-    3353,
-    3362,
-    3371,
-    3380,
-    3390,
-    3399,
-    3408,
-    3417,
-    3426,
-    3435,
-    3444,
-    3453,
-    3463,
-    3472,
-    3481,
-    3490,
-    3499,
-    3508,
-    3517,
-    3526,
-    3535,
-    3544,
-    3553,
-    3562,
-    3571,
-    3580,
-    3589,
-    3599,
-    3608,
-    3617,
-    3626,
-    3635,
-    3644,
-    3653,
-    3662,
-    3670,
-    3679,
-    3688,
-    3697,
-    3706,
-    3715,
-    3724,
-    3733,
-    3742,
-    3751,
-    3760,
-    3769,
-    3778,
-    3787,
-    3796,
-    3804,
-    3813,
-    3822,
-    3831,
-    3840,
-    3849,
-    3858,
-    3867,
-    3875,
-    3884,
-    3893,
-    3902,
-    3911,
-    3920,
-    3928,
-    3937,
-    3946,
-    3955,
-    3964,
-    3972,
-    3981,
-    3990,
-    3999,
-    4007,
-    4016,
-    4025,
-    4034,
-    4042,
-    4051,
-    4060,
-    4069,
-    4077,
-    4086,
-    4095,
-    4103,
-    4112,
-    4121,
-    4129,
-    4138,
-    4147,
-    4155,
-    4164,
-    4173,
-    4181,
-    4190,
-    4199,
-    4207,
-    4216,
-    4224,
-    4233,
-    4242,
-    4250,
-    4259,
-    4267,
-    4276,
-    4284,
-    4293,
-    4302,
-    4310,
-    4319,
-    4327,
-    4336,
-    4344,
-    4353,
-    4361,
-    4370,
-    4378,
-    4387,
-    4395,
-    4404,
-    4412,
-    4421,
-    4429,
-    4438,
-    4446,
-    4454,
-    4463,
-    4471,
-    4480,
-    4488,
-    4497,
-    4505,
-    4513,
-    4522,
-    4530,
-    4539,
-    4547,
-    4555,
-    4564,
-    4572,
-    4580,
-    4589,
-    4597,
-    4605,
-    4614,
-    4622,
-    4630,
-    4639,
-    4647,
-    4655,
-    4663,
-    4672,
-    4680,
-    4688,
-    4697,
-    4705,
-    4713,
-    4721,
-    4730,
-    4738,
-    4746,
-    4754,
-    4762,
-    4771,
-    4779,
-    4787,
-    4795,
-    4803,
-    4812,
-    4820,
-    4828,
-    4836,
-    4844,
-    4852,
-    4860,
-    4869,
-    4877,
-    4885,
-    4893,
-    4901,
-    4909,
-    4917,
-    4925,
-    4933,
-    4941,
-    4949,
-    4958,
-    4966,
-    4974,
-    4982,
-    4990,
-    4998,
-    5006,
-    5014,
-    5022,
-    5030,
-    5038,
-    5046,
-    5054,
-    5062,
-    5070,
-    5078,
-    5086,
-    5094,
-    5101,
-    5109,
-    5117,
-    5125,
-    5133,
-    5141,
-    5149,
-    5157,
-    5165,
-    5173,
-    5181,
-    5188,
-    5196,
-    5204,
-    5212,
-    5220,
-    5228,
-    5235,
-    5243,
-    5251,
-    5259,
-    5267,
-    5275,
-    5282,
-    5290,
-    5298,
-    5306,
-    5313,
-    5321,
-    5329,
-    5337,
-    5344,
-    5352,
-    5360,
-    5368,
-    5375,
-    5383,
-    5391,
-    5398,
-    5406,
-    5414,
-    5421,
-    5429,
-    5437,
-    5444,
-    5452,
-    5460,
-    5467,
-    5475,
-    5483,
-    5490,
-    5498,
-    5505,
-    5513,
-    5521,
-    5528,
-    5536,
-    5543,
-    5551,
-    5559,
-    5566,
-    5574,
-    5581,
-    5589,
-    5596,
-    5604,
-    5611,
-    5619,
-    5626,
-    5634,
-    5641,
-    5649,
-    5656,
-    5664,
-    5671,
-    5679,
-    5686,
-    5694,
-    5701,
-    5708,
-    5716,
-    5723,
-    5731,
-    5738,
-    5745,
-    5753,
-    5760,
-    5768,
-    5775,
-    5782,
-    5790,
-    5797,
-    5804,
-    5812,
-    5819,
-    5826,
-    5834,
-    5841,
-    5848,
-    5856,
-    5863,
-    5870,
-    5878,
-    5885,
-    5892,
-    5899,
-    5907,
-    5914,
-    5921,
-    5928,
-    5936,
-    5943,
-    5950,
-    5957,
-    5964,
-    5972,
-    5979,
-    5986,
-    5993,
-    6000,
-    6008,
-    6015,
-    6022,
-    6029,
-    6036,
-    6043,
-    6050,
-    6058,
-    6065,
-    6072,
-    6079,
-    6086,
-    6093,
-    6100,
-    6107,
-    6114,
-    6121,
-    6128,
-    6135,
-    6142,
-    6150,
-    6157,
-    6164,
-    6171,
-    6178,
-    6185,
-    6192,
-    6199,
-    6206,
-    6213,
-    6220,
-    6227,
-    6234,
-    6240,
-    6247,
-    6254,
-    6261,
-    6268,
-    6275,
-    6282,
-    6289,
-    6296,
-    6303,
-    6310,
-    6317,
-    6323,
-    6330,
-    6337,
-    6344,
-    6351,
-    6358,
-    6365,
-    6371,
-    6378,
-    6385,
-    6392,
-    6399,
-    6406,
-    6412,
-    6419,
-    6426,
-    6433,
-    6440,
-    6446,
-    6453,
-    6460,
-    6467,
-    6473,
-    6480,
-    6487,
-    6493,
-    6500,
-    6507,
-    6514,
-    6520,
-    6527,
-    6534,
-    6540,
-    6547,
-    6554,
-    6560,
-    6567,
-    6574,
-    6580,
-    6587,
-    6594,
-    6600,
-    6607,
-    6613,
-    6620,
-    6627,
-    6633,
-    6640,
-    6646,
-    6653,
-    6660,
-    6666,
-    6673,
-    6679,
-    6686,
-    6692,
-    6699,
-    6705,
-    6712,
-    6718,
-    6725,
-    6731,
-    6738,
-    6744,
-    6751,
-    6757,
-    6764,
-    6770,
-    6777,
-    6783,
-    6790,
-    6796,
-    6803,
-    6809,
-    6815,
-    6822,
-    6828,
-    6835,
-    6841,
-    6848,
-    6854,
-    6860,
-    6867,
-    6873,
-    6879,
-    6886,
-    6892,
-    6898,
-    6905,
-    6911,
-    6917,
-    6924,
-    6930,
-    6936,
-    6943,
-    6949,
-    6955,
-    6962,
-    6968,
-    6974,
-    6980,
-    6987,
-    6993,
-    6999,
-    7005,
-    7012,
-    7018,
-    7024,
-    7030,
-    7037,
-    7043,
-    7049,
-    7055,
-    7061,
-    7068,
-    7074,
-    7080,
-    7086,
-    7092,
-    7098,
-    7105,
-    7111,
-    7117,
-    7123,
-    7129,
-    7135,
-    7141,
-    7147,
-    7154,
-    7160,
-    7166,
-    7172,
-    7178,
-    7184,
-    7190,
-    7196,
-    7202,
-    7208,
-    7214,
-    7220,
-    7226,
-    7232,
-    7238,
-    7244,
-    7250,
-    7256,
-    7262,
-    7268,
-    7274,
-    7280,
-    7286,
-    7292,
-    7298,
-    7304,
-    7310,
-    7316,
-    7322,
-    7328,
-    7334,
-    7340,
-    7346,
-    7352,
-    7358,
-    7363,
-    7369,
-    7375,
-    7381,
-    7387,
-    7393,
-    7399,
-    7405,
-    7411,
-    7416,
-    7422,
-    7428,
-    7434,
-    7440,
-    7446,
-    7451,
-    7457,
-    7463,
-    7469,
-    7475,
-    7480,
-    7486,
-    7492,
-    7498,
-    7503,
-    7509,
-    7515,
-    7521,
-    7526,
-    7532,
-    7538,
-    7544,
-    7549,
-    7555,
-    7561,
-    7566,
-    7572,
-    7578,
-    7584,
-    7589,
-    7595,
-    7601,
-    7606,
-    7612,
-    7618,
-    7623,
-    7629,
-    7635,
-    7640,
-    7646,
-    7651,
-    7657,
-    7663,
-    7668,
-    7674,
-    7679,
-    7685,
-    7691,
-    7696,
-    7702,
-    7707,
-    7713,
-    7718,
-    7724,
-    7730,
-    7735,
-    7741,
-    7746,
-    7752,
-    7757,
-    7763,
-    7768,
-    7774,
-    7779,
-    7785,
-    7790,
-    7796,
-    7801,
-    7807,
-    7812,
-    7818,
-    7823,
-    7828,
-    7834,
-    7839,
-    7845,
-    7850,
-    7856,
-    7861,
-    7866,
-    7872,
-    7877,
-    7883,
-    7888,
-    7893,
-    7899,
-    7904,
-    7910,
-    7915,
-    7920,
-    7926,
-    7931,
-    7936,
-    7942,
-    7947,
-    7952,
-    7958,
-    7963,
-    7968,
-    7974,
-    7979,
-    7984,
-    7990,
-    7995,
-    8000,
-    8005,
-    8011,
-    8016,
-    8021,
-    8026,
-    8032,
-    8037,
-    8042,
-    8047,
-    8053,
-    8058,
-    8063,
-    8068,
-    8074,
-    8079,
-    8084,
-    8089,
-    8094,
-    8100,
-    8105,
-    8110,
-    8115,
-    8120,
-    8125,
-    8131,
-    8136,
-    8141,
-    8146,
-    8151,
-    8156,
-    8161,
-    8166,
-    8172,
-    8177,
-    8182,
-    8187,
-    8192,
-};
+
+// The tables are written into the build directory by math_tables_gen
+
+// A sine wave and a quarter, so cosines can index 0x400 ahead
+#define SINE_TABLE_SIZE 0x1400
+#define ARCTAN_TABLE_SIZE 0x401
+
+// FNV-1a of the N64's tables, as little-endian bytes
+#define SINE_TABLE_HASH 0x77C9F62B8B4125B1ull
+#define ARCTAN_TABLE_HASH 0xB3E604FEF87778D8ull
+
+// gSinCosTable, declared in math_util.h, has a { sin, cos } pair for each of
+// the 4096 table angles
+#define SIN_COS_TABLE_SIZE 0x1000
+
+// { sin, cos } pairs for the angles flying pitch is clamped to, [-0x2AAA, 0x2AAA]
+#define PITCH_SIN_COS_TABLE_OFFSET ((0x2AAA >> 4) + 1)
+#define PITCH_SIN_COS_TABLE_SIZE (2 * PITCH_SIN_COS_TABLE_OFFSET)
+
+extern const f32 gPitchSinCosTable[PITCH_SIN_COS_TABLE_SIZE][2];
+
+// Same as sincoss, sins and coss, for angles in [-0x2AAA, 0x2AAA] only
+#define sincoss_pitch(x) gPitchSinCosTable[((s16) (x) >> 4) + PITCH_SIN_COS_TABLE_OFFSET]
+#define sins_pitch(x) sincoss_pitch(x)[0]
+#define coss_pitch(x) sincoss_pitch(x)[1]
+
+// atan(i / 1024) for atan2s
+extern const s16 D_8038B000[ARCTAN_TABLE_SIZE];
+
+#endif
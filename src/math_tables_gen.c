@@ -0,0 +1,116 @@
+// Writes math_tables.c: the sine and arctangent tables from the N64, and
+// layouts derived from the sine table. Refuses to write anything if the
+// generated N64 tables don't hash to the originals, so a libm that rounds
+// differently fails the build instead of changing the physics.
+//
+// Usage: math_tables_gen <output.c>
+
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "math_tables.h"
+
+
+static f32 sSineTable[SINE_TABLE_SIZE];
+static s16 sArctanTable[ARCTAN_TABLE_SIZE];
+
+static u64 table_hash(const void *data, size_t size) {
+    const u8 *bytes = data;
+    u64 hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// sin(2 pi i / 4096) rounded from double. The table is built from its first
+// quarter so it's exactly symmetric, with true zeros at pi and 2 pi.
+static void generate_sine_table(void) {
+    f32 quarter[0x400 + 1];
+    for (s32 i = 0; i <= 0x400; i++) {
+        quarter[i] = (f32) sin(i * (2.0 * M_PI / 0x1000));
+    }
+
+    for (s32 i = 0; i < SINE_TABLE_SIZE; i++) {
+        s32 j = i & 0xFFF;
+        if (j <= 0x400)
+            sSineTable[i] = quarter[j];
+        else if (j <= 0x800)
+            sSineTable[i] = quarter[0x800 - j];
+        else if (j <= 0xC00)
+            sSineTable[i] = -quarter[j - 0x800];
+        else
+            sSineTable[i] = -quarter[0x1000 - j];
+    }
+}
+
+// atan(i / 1024) in angle units, rounded to nearest
+static void generate_arctan_table(void) {
+    for (s32 i = 0; i < ARCTAN_TABLE_SIZE; i++) {
+        sArctanTable[i] = (s16) lround(atan(i / 1024.0) * (0x8000 / M_PI));
+    }
+}
+
+static void write_f32(FILE *f, f32 x) {
+    // Hex floats round trip exactly
+    fprintf(f, "    %af,\n", x);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        printf("Usage: math_tables_gen <output.c>\n");
+        exit(1);
+    }
+
+    generate_sine_table();
+    generate_arctan_table();
+
+    u64 sineHash = table_hash(sSineTable, sizeof(sSineTable));
+    u64 arctanHash = table_hash(sArctanTable, sizeof(sArctanTable));
+    if (sineHash != SINE_TABLE_HASH || arctanHash != ARCTAN_TABLE_HASH) {
+        printf("Generated tables don't match the N64's (sine %016llX, arctan %016llX)\n",
+            (unsigned long long) sineHash, (unsigned long long) arctanHash);
+        exit(1);
+    }
+
+    FILE *f = fopen(argv[1], "w");
+    if (f == NULL) {
+        printf("Failed to open %s\n", argv[1]);
+        exit(1);
+    }
+
+    fprintf(f, "// Generated by math_tables_gen. Do not edit.\n\n");
+    fprintf(f, "#include \"math_tables.h\"\n\n");
+
+    fprintf(f, "const f32 gSineTable[SINE_TABLE_SIZE] = {\n");
+    for (s32 i = 0; i < SINE_TABLE_SIZE; i++) {
+        write_f32(f, sSineTable[i]);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const f32 gSinCosTable[SIN_COS_TABLE_SIZE][2] = {\n");
+    for (s32 i = 0; i < SIN_COS_TABLE_SIZE; i++) {
+        fprintf(f, "    { %af, %af },\n", sSineTable[i], sSineTable[i + 0x400]);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const f32 gPitchSinCosTable[PITCH_SIN_COS_TABLE_SIZE][2] = {\n");
+    for (s32 i = 0; i < PITCH_SIN_COS_TABLE_SIZE; i++) {
+        s32 j = (i - PITCH_SIN_COS_TABLE_OFFSET) & 0xFFF;
+        fprintf(f, "    { %af, %af },\n", sSineTable[j], sSineTable[j + 0x400]);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const s16 D_8038B000[ARCTAN_TABLE_SIZE] = {\n");
+    for (s32 i = 0; i < ARCTAN_TABLE_SIZE; i++) {
+        fprintf(f, "    %d,\n", sArctanTable[i]);
+    }
+    fprintf(f, "};\n");
+
+    if (fclose(f) != 0) {
+        printf("Failed to write %s\n", argv[1]);
+        exit(1);
+    }
+    return 0;
+}
@@ -28,10 +28,14 @@ typedef s16 Vec4s[4];
 
 typedef f32 Mat4[4][4];
 
-extern f32 gSineTable[];
-
-#define sins(x) gSineTable[(u16) (x) >> 4]
-#define coss(x) gSineTable[(u16) (x + 0x4000) >> 4]
+extern const f32 gSineTable[];
+extern const f32 gSinCosTable[][2];
+
+// { sin, cos } of an angle, next to each other. The same values as indexing
+// gSineTable at the angle and a quarter turn ahead.
+#define sincoss(x) gSinCosTable[(u16) (x) >> 4]
+#define sins(x) sincoss(x)[0]
+#define coss(x) sincoss(x)[1]
 
 #define min(a, b) ((a) <= (b) ? (a) : (b))
 #define max(a, b) ((a) > (b) ? (a) : (b))
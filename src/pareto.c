@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pareto.h"
+
+
+static void *pareto_alloc(size_t size) {
+    void *p = malloc(max(size, 1));
+    if (p == NULL) {
+        printf("Failed to allocate %zu bytes for a Pareto frontier\n", size);
+        exit(1);
+    }
+    return p;
+}
+
+static struct ParetoBucket *alloc_buckets(u32 count) {
+    struct ParetoBucket *buckets = pareto_alloc(count * sizeof(struct ParetoBucket));
+    for (u32 i = 0; i < count; i++) {
+        buckets[i].count = -1;
+        buckets[i].capacity = 0;
+        buckets[i].points = NULL;
+    }
+    return buckets;
+}
+
+static u32 bucket_hash(u32 key) {
+    key *= 0x9E3779B1u;
+    return key ^ key >> 15;
+}
+
+void pareto_init(struct ParetoFrontier *f) {
+    f->mask = 1023;
+    f->buckets = alloc_buckets(f->mask + 1);
+    f->numBuckets = 0;
+    f->numPoints = 0;
+}
+
+void pareto_free(struct ParetoFrontier *f) {
+    for (u32 i = 0; i <= f->mask; i++) {
+        free(f->buckets[i].points);
+    }
+    free(f->buckets);
+    memset(f, 0, sizeof(*f));
+}
+
+void pareto_clear(struct ParetoFrontier *f) {
+    for (u32 i = 0; i <= f->mask; i++) {
+        f->buckets[i].count = -1;
+    }
+    f->numBuckets = 0;
+    f->numPoints = 0;
+}
+
+// Keeps the load at most one half
+static void grow(struct ParetoFrontier *f) {
+    struct ParetoBucket *old = f->buckets;
+    u32 oldMask = f->mask;
+
+    f->mask = 2 * f->mask + 1;
+    f->buckets = alloc_buckets(f->mask + 1);
+
+    for (u32 i = 0; i <= oldMask; i++) {
+        if (old[i].count < 0) {
+            free(old[i].points);
+            continue;
+        }
+        u32 slot = bucket_hash(old[i].key) & f->mask;
+        while (f->buckets[slot].count >= 0) {
+            slot = (slot + 1) & f->mask;
+        }
+        f->buckets[slot] = old[i];
+    }
+    free(old);
+}
+
+static struct ParetoBucket *find_bucket(struct ParetoFrontier *f, u32 key) {
+    u32 slot = bucket_hash(key) & f->mask;
+    while (f->buckets[slot].count >= 0 && f->buckets[slot].key != key) {
+        slot = (slot + 1) & f->mask;
+    }
+
+    struct ParetoBucket *b = &f->buckets[slot];
+    if (b->count < 0) {
+        if (2 * (f->numBuckets + 1) > (s32)(f->mask + 1)) {
+            grow(f);
+            return find_bucket(f, key);
+        }
+        b->key = key;
+        b->count = 0;
+        f->numBuckets += 1;
+    }
+    return b;
+}
+
+s32 pareto_insert(struct ParetoFrontier *f, s16 pitch, s16 pitchVel, f32 posY, f32 forwardVel, s32 id) {
+    struct ParetoBucket *b = find_bucket(f, (u32)(u16) pitch << 16 | (u16) pitchVel);
+    struct ParetoPoint *p = b->points;
+
+    // First point not strictly higher. The last point before it has the most
+    // speed of all the higher points.
+    s32 lo = 0;
+    s32 hi = b->count;
+    while (lo < hi) {
+        s32 mid = (lo + hi) / 2;
+        if (p[mid].posY > posY) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo > 0 && p[lo - 1].forwardVel >= forwardVel) {
+        return FALSE;
+    }
+    if (lo < b->count && p[lo].posY == posY && p[lo].forwardVel >= forwardVel) {
+        return FALSE;
+    }
+
+    // Points from lo on are no higher, and the ones that are also no faster form a run
+    s32 end = lo;
+    while (end < b->count && p[end].forwardVel <= forwardVel) {
+        end++;
+    }
+
+    s32 count = b->count - (end - lo) + 1;
+    if (count > b->capacity) {
+        b->capacity = max(2 * b->capacity, 8);
+        b->points = realloc(b->points, b->capacity * sizeof(struct ParetoPoint));
+        if (b->points == NULL) {
+            printf("Failed to allocate %d Pareto points\n", b->capacity);
+            exit(1);
+        }
+        p = b->points;
+    }
+
+    memmove(&p[lo + 1], &p[end], (b->count - end) * sizeof(struct ParetoPoint));
+    p[lo].posY = posY;
+    p[lo].forwardVel = forwardVel;
+    p[lo].id = id;
+
+    f->numPoints += count - b->count;
+    b->count = count;
+    return TRUE;
+}
+
+void pareto_for_each(const struct ParetoFrontier *f, void (*fn)(void *arg, s32 id), void *arg) {
+    for (u32 i = 0; i <= f->mask; i++) {
+        const struct ParetoBucket *b = &f->buckets[i];
+        for (s32 k = 0; k < b->count; k++) {
+            fn(arg, b->points[k].id);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef PARETO_H_
+#define PARETO_H_
+
+#include "math_util.h"
+
+
+struct ParetoPoint
+{
+    f32 posY;
+    f32 forwardVel;
+    // Caller's handle for the state, e.g. its index in a batch
+    s32 id;
+};
+
+// Points that share a pitch and pitch vel, sorted by descending y and so by
+// ascending speed. No point has both higher y and higher speed than another.
+struct ParetoBucket
+{
+    u32 key;
+    s32 count;
+    s32 capacity;
+    struct ParetoPoint *points;
+};
+
+/**
+ * Sets of states where, for the same pitch and pitch vel, a state with both
+ * higher y and higher speed than another replaces it. This assumes the yaw and
+ * yaw vel are the same for every state, as they are with rawStickX = 0.
+ *
+ * Dominance is a heuristic rather than a rule of the dynamics: more speed also
+ * pitches Mario up faster, so the two states don't fly the same path. flight
+ * check --dominance measures how often it holds.
+ */
+struct ParetoFrontier
+{
+    // Open addressing on key, count == -1 for an empty slot
+    struct ParetoBucket *buckets;
+    u32 mask;
+    s32 numBuckets;
+    s32 numPoints;
+};
+
+void pareto_init(struct ParetoFrontier *f);
+void pareto_free(struct ParetoFrontier *f);
+// Empties every bucket but keeps the memory
+void pareto_clear(struct ParetoFrontier *f);
+
+/**
+ * Adds a state unless a point in its bucket has at least its y and speed, and
+ * removes the points it dominates. Returns whether the state was added.
+ */
+s32 pareto_insert(struct ParetoFrontier *f, s16 pitch, s16 pitchVel, f32 posY, f32 forwardVel, s32 id);
+
+// Calls fn with the id of every point on the frontier
+void pareto_for_each(const struct ParetoFrontier *f, void (*fn)(void *arg, s32 id), void *arg);
+
+#endif
@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tas_inputs.h"
+
+
+// Super Mario 64 (U)
+const struct M64Options gM64DefaultOptions = {
+    .romName = "SUPER MARIO 64",
+    .romCrc = 0x635A2BFF,
+    .romCountry = 0x45,
+    .startType = 1,
+    .author = "",
+    .description = "Wing cap flight generated by sm64-flight",
+};
+
+void tas_inputs_init(struct TasInputs *t) {
+    memset(t, 0, sizeof(*t));
+}
+
+void tas_inputs_free(struct TasInputs *t) {
+    free(t->inputs);
+    memset(t, 0, sizeof(*t));
+}
+
+void tas_inputs_clear(struct TasInputs *t) {
+    t->count = 0;
+}
+
+void tas_inputs_push(struct TasInputs *t, u16 buttons, s8 stickX, s8 stickY) {
+    if (t->count == t->capacity) {
+        t->capacity = max(2 * t->capacity, 1024);
+        t->inputs = realloc(t->inputs, t->capacity * sizeof(struct TasInput));
+        if (t->inputs == NULL) {
+            printf("Failed to allocate %d TAS inputs\n", t->capacity);
+            exit(1);
+        }
+    }
+
+    t->inputs[t->count].buttons = buttons;
+    t->inputs[t->count].stickX = stickX;
+    t->inputs[t->count].stickY = stickY;
+    t->count += 1;
+}
+
+static s32 write_file(const char *path, const void *data, size_t size) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return FALSE;
+    }
+
+    s32 ok = fwrite(data, 1, size, f) == size;
+    ok = fclose(f) == 0 && ok;
+    return ok;
+}
+
+s32 tas_inputs_write_text(const struct TasInputs *t, const char *path) {
+    static const char hex[] = "0123456789abcdef";
+    enum { FRAME_CHARS = 10 };
+
+    char *text = malloc((size_t) t->count * FRAME_CHARS + 1);
+    if (text == NULL) {
+        return FALSE;
+    }
+
+    char *c = text;
+    for (s32 i = 0; i < t->count; i++) {
+        const struct TasInput *input = &t->inputs[i];
+        u8 bytes[4] = { input->buttons >> 8, input->buttons & 0xFF, (u8) input->stickX, (u8) input->stickY };
+
+        for (s32 j = 0; j < 4; j++) {
+            *c++ = hex[bytes[j] >> 4];
+            *c++ = hex[bytes[j] & 0xF];
+            if (j == 1) {
+                *c++ = ' ';
+            }
+        }
+        *c++ = ' ';
+    }
+
+    s32 ok = write_file(path, text, c - text);
+    free(text);
+    return ok;
+}
+
+static void put_u16(u8 *p, u16 v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void put_u32(u8 *p, u32 v) {
+    put_u16(p, v & 0xFFFF);
+    put_u16(p + 2, v >> 16);
+}
+
+static void put_string(u8 *p, const char *s, size_t size) {
+    strncpy((char *) p, s, size - 1);
+}
+
+s32 tas_inputs_write_m64(const struct TasInputs *t, const char *path, const struct M64Options *options) {
+    enum { HEADER_SIZE = 0x400 };
+
+    size_t size = HEADER_SIZE + (size_t) t->count * 4;
+    u8 *data = calloc(size, 1);
+    if (data == NULL) {
+        return FALSE;
+    }
+
+    memcpy(data, "M64\x1A", 4);
+    put_u32(data + 0x004, 3);
+    put_u32(data + 0x008, (u32) time(NULL));
+    // The game polls the controller every other VI
+    put_u32(data + 0x00C, 2 * t->count);
+    put_u32(data + 0x010, 0);
+    data[0x014] = 60;
+    data[0x015] = 1;
+    put_u32(data + 0x018, t->count);
+    put_u16(data + 0x01C, options->startType);
+    put_u32(data + 0x020, 1);
+    put_string(data + 0x0C4, options->romName, 32);
+    put_u32(data + 0x0E4, options->romCrc);
+    put_u16(data + 0x0E8, options->romCountry);
+    put_string(data + 0x222, options->author, 222);
+    put_string(data + 0x300, options->description, 256);
+
+    // Samples are buttons (little endian) followed by the x and y axes
+    u8 *sample = data + HEADER_SIZE;
+    for (s32 i = 0; i < t->count; i++) {
+        put_u16(sample, t->inputs[i].buttons);
+        sample[2] = (u8) t->inputs[i].stickX;
+        sample[3] = (u8) t->inputs[i].stickY;
+        sample += 4;
+    }
+
+    s32 ok = write_file(path, data, size);
+    free(data);
+    return ok;
+}
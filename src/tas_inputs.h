@@ -0,0 +1,57 @@
+#ifndef TAS_INPUTS_H_
+#define TAS_INPUTS_H_
+
+#include "math_util.h"
+
+
+// One controller poll, laid out like a Mupen64 input sample
+struct TasInput
+{
+    u16 buttons;
+    s8 stickX;
+    s8 stickY;
+};
+
+/**
+ * Inputs buffered in memory while simulating, written to disk in one go
+ * afterwards.
+ */
+struct TasInputs
+{
+    struct TasInput *inputs;
+    s32 count;
+    s32 capacity;
+};
+
+// Fields of the .m64 header that describe the ROM and how playback starts
+struct M64Options
+{
+    const char *romName;
+    u32 romCrc;
+    u16 romCountry;
+    // 1 = from a savestate next to the movie, 2 = from power on
+    u16 startType;
+    const char *author;
+    const char *description;
+};
+
+extern const struct M64Options gM64DefaultOptions;
+
+void tas_inputs_init(struct TasInputs *t);
+void tas_inputs_free(struct TasInputs *t);
+void tas_inputs_clear(struct TasInputs *t);
+void tas_inputs_push(struct TasInputs *t, u16 buttons, s8 stickX, s8 stickY);
+
+/**
+ * Writes the inputs as hex text, "BBBB XXYY " per frame (the original
+ * tas_inputs.txt format). Returns FALSE if the file can't be written.
+ */
+s32 tas_inputs_write_text(const struct TasInputs *t, const char *path);
+
+/**
+ * Writes a Mupen64 version 3 movie for a single controller. Returns FALSE if
+ * the file can't be written.
+ */
+s32 tas_inputs_write_m64(const struct TasInputs *t, const char *path, const struct M64Options *options);
+
+#endif
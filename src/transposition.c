@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "transposition.h"
+
+
+// Slots probed per key
+#define TRANSPOSITION_WINDOW 8
+
+void transposition_init(struct TranspositionTable *t, size_t maxBytes) {
+    size_t count = TRANSPOSITION_WINDOW;
+    while (2 * count * sizeof(struct TranspositionEntry) <= maxBytes) {
+        count *= 2;
+    }
+
+    memset(t, 0, sizeof(*t));
+    t->entries = malloc(count * sizeof(struct TranspositionEntry));
+    if (t->entries == NULL) {
+        printf("Failed to allocate a transposition table of %zu entries\n", count);
+        exit(1);
+    }
+    t->mask = count - 1;
+    transposition_clear(t);
+}
+
+void transposition_free(struct TranspositionTable *t) {
+    free(t->entries);
+    memset(t, 0, sizeof(*t));
+}
+
+void transposition_clear(struct TranspositionTable *t) {
+    for (u64 i = 0; i <= t->mask; i++) {
+        t->entries[i].frame = -1;
+    }
+    t->lookups = 0;
+    t->hits = 0;
+    t->occupied = 0;
+    t->replacements = 0;
+}
+
+void transposition_save(const struct TranspositionTable *t, struct CheckpointWriter *w) {
+    checkpoint_write(w, &t->mask, sizeof(t->mask));
+    checkpoint_write(w, t->entries, (t->mask + 1) * sizeof(struct TranspositionEntry));
+    checkpoint_write(w, &t->lookups, sizeof(t->lookups));
+    checkpoint_write(w, &t->hits, sizeof(t->hits));
+    checkpoint_write(w, &t->occupied, sizeof(t->occupied));
+    checkpoint_write(w, &t->replacements, sizeof(t->replacements));
+}
+
+void transposition_load(struct TranspositionTable *t, struct CheckpointReader *r) {
+    u64 mask;
+    checkpoint_read(r, &mask, sizeof(mask));
+    if (mask != t->mask) {
+        printf("%s has a transposition table of %llu entries, not %llu\n", r->path,
+            (unsigned long long) mask + 1, (unsigned long long) t->mask + 1);
+        exit(1);
+    }
+    checkpoint_read(r, t->entries, (t->mask + 1) * sizeof(struct TranspositionEntry));
+    checkpoint_read(r, &t->lookups, sizeof(t->lookups));
+    checkpoint_read(r, &t->hits, sizeof(t->hits));
+    checkpoint_read(r, &t->occupied, sizeof(t->occupied));
+    checkpoint_read(r, &t->replacements, sizeof(t->replacements));
+}
+
+u64 flight_key_hash(const struct FlightKey *key) {
+    u64 a;
+    u64 b;
+    memcpy(&a, key, sizeof(u64));
+    memcpy(&b, (const u8 *) key + sizeof(u64), sizeof(u64));
+
+    // Murmur3 finalizer over a mix of both halves
+    u64 h = a * 0x9E3779B97F4A7C15ull ^ (b + 0x632BE59BD9B4E019ull);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+void transposition_prefetch(const struct TranspositionTable *t, u64 hash) {
+    __builtin_prefetch(&t->entries[hash & t->mask]);
+    __builtin_prefetch(&t->entries[(hash + TRANSPOSITION_WINDOW - 1) & t->mask]);
+}
+
+s32 transposition_visit(struct TranspositionTable *t, const struct FlightKey *key, s32 frame) {
+    return transposition_visit_hashed(t, key, flight_key_hash(key), frame);
+}
+
+s32 transposition_visit_hashed(struct TranspositionTable *t, const struct FlightKey *key, u64 hash, s32 frame) {
+    if (transposition_contains_hashed(t, key, hash, frame)) {
+        return TRUE;
+    }
+    transposition_insert_hashed(t, key, hash, frame);
+    return FALSE;
+}
+
+s32 transposition_contains_hashed(struct TranspositionTable *t, const struct FlightKey *key, u64 hash, s32 frame) {
+    t->lookups += 1;
+
+    for (s32 i = 0; i < TRANSPOSITION_WINDOW; i++) {
+        const struct TranspositionEntry *e = &t->entries[(hash + i) & t->mask];
+
+        // Entries are never removed, so the key can't be past an empty slot
+        if (e->frame < 0) {
+            return FALSE;
+        }
+        if (memcmp(&e->key, key, sizeof(struct FlightKey)) == 0) {
+            if (e->frame <= frame) {
+                t->hits += 1;
+                return TRUE;
+            }
+            return FALSE;
+        }
+    }
+    return FALSE;
+}
+
+void transposition_insert_hashed(struct TranspositionTable *t, const struct FlightKey *key, u64 hash, s32 frame) {
+    struct TranspositionEntry *victim = NULL;
+
+    for (s32 i = 0; i < TRANSPOSITION_WINDOW; i++) {
+        struct TranspositionEntry *e = &t->entries[(hash + i) & t->mask];
+
+        if (e->frame < 0) {
+            victim = e;
+            break;
+        }
+        if (memcmp(&e->key, key, sizeof(struct FlightKey)) == 0) {
+            e->frame = min(e->frame, frame);
+            return;
+        }
+        if (victim == NULL || e->frame < victim->frame) {
+            victim = e;
+        }
+    }
+
+    if (victim->frame < 0) {
+        t->occupied += 1;
+    } else {
+        t->replacements += 1;
+    }
+    victim->key = *key;
+    victim->frame = frame;
+}
+
+void transposition_print_stats(const struct TranspositionTable *t, FILE *f) {
+    u64 count = t->mask + 1;
+    fprintf(f, "Transposition table: %.1f MB, %.1f%% full, %.1f%% of %lld lookups hit, %lld replacements\n",
+        (f64) count * sizeof(struct TranspositionEntry) / (1 << 20), 100.0 * t->occupied / count,
+        t->lookups > 0 ? 100.0 * t->hits / t->lookups : 0.0, (long long) t->lookups, (long long) t->replacements);
+}
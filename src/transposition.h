@@ -0,0 +1,76 @@
+#ifndef TRANSPOSITION_H_
+#define TRANSPOSITION_H_
+
+#include <stdio.h>
+
+#include "checkpoint.h"
+#include "math_util.h"
+
+
+// Every part of a flying state that act_flying reads, as exact bits. faceAngle[2]
+// is left out since it's derived from angleVel[1].
+struct FlightKey
+{
+    u32 posY;
+    u32 forwardVel;
+    s16 pitch;
+    s16 pitchVel;
+    s16 yaw;
+    s16 yawVel;
+};
+
+struct TranspositionEntry
+{
+    struct FlightKey key;
+    // First frame the state was reached at, or -1 if the slot is empty
+    s32 frame;
+};
+
+/**
+ * Fixed size open addressing set of states, for planners to skip states they
+ * have already reached by another path. Each key probes a short window of slots;
+ * when the window is full the entry with the lowest frame is replaced, since
+ * searches move forward in time and old states are the least likely to recur.
+ * Not thread safe.
+ */
+struct TranspositionTable
+{
+    struct TranspositionEntry *entries;
+    u64 mask;
+
+    s64 lookups;
+    s64 hits;
+    s64 occupied;
+    s64 replacements;
+};
+
+// Uses the largest power of two number of entries that fits in maxBytes
+void transposition_init(struct TranspositionTable *t, size_t maxBytes);
+void transposition_free(struct TranspositionTable *t);
+void transposition_clear(struct TranspositionTable *t);
+
+/**
+ * Returns TRUE if the state was already reached at this frame or an earlier one.
+ * Otherwise records it as reached at this frame and returns FALSE.
+ */
+s32 transposition_visit(struct TranspositionTable *t, const struct FlightKey *key, s32 frame);
+
+// For visiting many keys: hash them up front (from any thread), then prefetch
+// a few keys ahead of the one being visited to hide the cache misses
+u64 flight_key_hash(const struct FlightKey *key);
+void transposition_prefetch(const struct TranspositionTable *t, u64 hash);
+s32 transposition_visit_hashed(struct TranspositionTable *t, const struct FlightKey *key, u64 hash, s32 frame);
+
+// The two halves of transposition_visit, for planners that only record the
+// states they end up keeping. Only lookups count toward the hit rate.
+s32 transposition_contains_hashed(struct TranspositionTable *t, const struct FlightKey *key, u64 hash, s32 frame);
+void transposition_insert_hashed(struct TranspositionTable *t, const struct FlightKey *key, u64 hash, s32 frame);
+
+// Every entry and the stats. Loading needs a table of the same size.
+void transposition_save(const struct TranspositionTable *t, struct CheckpointWriter *w);
+void transposition_load(struct TranspositionTable *t, struct CheckpointReader *r);
+
+// Hit rate, occupancy and replacements on one line
+void transposition_print_stats(const struct TranspositionTable *t, FILE *f);
+
+#endif
@@ -0,0 +1,191 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "work_pool.h"
+
+
+// Range of indices [begin, end) packed as end << 32 | begin so that the owner
+// and thieves can update it with a single compare and swap. Padded to its own
+// cache line.
+struct WorkRange
+{
+    _Alignas(64) _Atomic u64 range;
+};
+
+struct WorkPool
+{
+    struct WorkRange *ranges;
+    s32 numThreads;
+    WorkFn fn;
+    void *arg;
+};
+
+// Worker threads are started on first use and parked between batches, so
+// callers that run a batch per frame don't create threads every frame. One
+// batch runs at a time; sLock guards everything below it.
+static pthread_mutex_t sRunLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t sLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sWake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t sDone = PTHREAD_COND_INITIALIZER;
+// Current batch, and how many of its workers haven't finished
+static struct WorkPool sPool;
+static u64 sBatch;
+static s32 sBusy;
+// Workers started, which have thread indices 1 to sNumWorkers
+static s32 sNumWorkers;
+static s32 sRangeCapacity;
+// Set on every thread while it works on a batch
+static _Thread_local s32 sInBatch;
+
+static u64 pack_range(u32 begin, u32 end) {
+    return (u64) end << 32 | begin;
+}
+
+static u32 range_begin(u64 range) {
+    return (u32) range;
+}
+
+static u32 range_end(u64 range) {
+    return (u32)(range >> 32);
+}
+
+s32 work_pool_default_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (s32) n : 1;
+}
+
+// Takes the first index of the thread's own range
+static s32 take_front(struct WorkRange *own, s32 *index) {
+    u64 range = atomic_load_explicit(&own->range, memory_order_relaxed);
+    while (range_begin(range) < range_end(range)) {
+        u64 next = pack_range(range_begin(range) + 1, range_end(range));
+        if (atomic_compare_exchange_weak_explicit(&own->range, &range, next,
+                memory_order_relaxed, memory_order_relaxed)) {
+            *index = range_begin(range);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// Moves the back half of some other thread's range into the thread's own
+// (empty) range. Returns FALSE once every range is empty.
+static s32 steal(struct WorkPool *pool, s32 thread) {
+    for (s32 i = 1; i < pool->numThreads; i++) {
+        struct WorkRange *victim = &pool->ranges[(thread + i) % pool->numThreads];
+        u64 range = atomic_load_explicit(&victim->range, memory_order_relaxed);
+
+        while (range_begin(range) < range_end(range)) {
+            u32 half = (range_end(range) - range_begin(range) + 1) / 2;
+            u32 split = range_end(range) - half;
+            if (atomic_compare_exchange_weak_explicit(&victim->range, &range,
+                    pack_range(range_begin(range), split), memory_order_relaxed, memory_order_relaxed)) {
+                atomic_store_explicit(&pool->ranges[thread].range, pack_range(split, range_end(range)),
+                    memory_order_relaxed);
+                return TRUE;
+            }
+        }
+    }
+    return FALSE;
+}
+
+static void work_on_batch(struct WorkPool *pool, s32 thread) {
+    s32 index;
+
+    sInBatch = TRUE;
+    do {
+        while (take_front(&pool->ranges[thread], &index)) {
+            pool->fn(pool->arg, index, thread);
+        }
+    } while (steal(pool, thread));
+    sInBatch = FALSE;
+}
+
+static void *work_thread(void *arg) {
+    s32 thread = (s32)(size_t) arg;
+    u64 seen = 0;
+
+    pthread_mutex_lock(&sLock);
+    while (TRUE) {
+        while (sBatch == seen) {
+            pthread_cond_wait(&sWake, &sLock);
+        }
+        seen = sBatch;
+        if (thread >= sPool.numThreads) {
+            continue;
+        }
+
+        pthread_mutex_unlock(&sLock);
+        work_on_batch(&sPool, thread);
+        pthread_mutex_lock(&sLock);
+
+        if (--sBusy == 0) {
+            pthread_cond_signal(&sDone);
+        }
+    }
+    return NULL;
+}
+
+static void start_workers(s32 numWorkers) {
+    for (s32 i = sNumWorkers + 1; i <= numWorkers; i++) {
+        pthread_t handle;
+        if (pthread_create(&handle, NULL, work_thread, (void *)(size_t) i) != 0) {
+            printf("Failed to start thread %d\n", i);
+            exit(1);
+        }
+        pthread_detach(handle);
+    }
+    sNumWorkers = max(sNumWorkers, numWorkers);
+}
+
+void work_pool_run(s32 count, s32 numThreads, WorkFn fn, void *arg) {
+    numThreads = max(min(numThreads, count), 1);
+
+    if (sInBatch) {
+        printf("work_pool_run can't be called from inside a batch\n");
+        exit(1);
+    }
+
+    pthread_mutex_lock(&sRunLock);
+
+    // No worker is running, so the ranges can be reallocated
+    if (sRangeCapacity < numThreads) {
+        free(sPool.ranges);
+        sPool.ranges = aligned_alloc(64, numThreads * sizeof(struct WorkRange));
+        if (sPool.ranges == NULL) {
+            printf("Failed to allocate a pool of %d threads\n", numThreads);
+            exit(1);
+        }
+        sRangeCapacity = numThreads;
+    }
+    for (s32 i = 0; i < numThreads; i++) {
+        u32 begin = (s64) count * i / numThreads;
+        u32 end = (s64) count * (i + 1) / numThreads;
+        atomic_store_explicit(&sPool.ranges[i].range, pack_range(begin, end), memory_order_relaxed);
+    }
+
+    pthread_mutex_lock(&sLock);
+    start_workers(numThreads - 1);
+    sPool.numThreads = numThreads;
+    sPool.fn = fn;
+    sPool.arg = arg;
+    sBusy = numThreads - 1;
+    sBatch++;
+    if (numThreads > 1) {
+        pthread_cond_broadcast(&sWake);
+    }
+    pthread_mutex_unlock(&sLock);
+
+    work_on_batch(&sPool, 0);
+
+    pthread_mutex_lock(&sLock);
+    while (sBusy > 0) {
+        pthread_cond_wait(&sDone, &sLock);
+    }
+    pthread_mutex_unlock(&sLock);
+
+    pthread_mutex_unlock(&sRunLock);
+}
@@ -0,0 +1,24 @@
+#ifndef WORK_POOL_H_
+#define WORK_POOL_H_
+
+#include "math_util.h"
+
+
+// Called once for every index. thread is in [0, numThreads) and can be used to
+// pick per-thread scratch memory.
+typedef void (*WorkFn)(void *arg, s32 index, s32 thread);
+
+// Number of online CPUs
+s32 work_pool_default_threads(void);
+
+/**
+ * Calls fn for every index in [0, count) on numThreads threads (the calling
+ * thread is one of them) and returns once all calls are done. Every thread
+ * starts with an equal share of the indices and steals half of another
+ * thread's remaining share when it runs out, so uneven work still balances.
+ * The other threads are started on first use and reused by later calls. One
+ * call runs at a time, and fn must not call work_pool_run itself.
+ */
+void work_pool_run(s32 count, s32 numThreads, WorkFn fn, void *arg);
+
+#endif
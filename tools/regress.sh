@@ -0,0 +1,34 @@
+#!/bin/sh
+# Runs two builds of flight on the same start states and checks that run()
+# prints the same output and writes the same tas_inputs.txt.
+#
+# Usage: tools/regress.sh <old flight binary> <new flight binary>
+
+if [ $# -ne 2 ]; then
+    echo "Usage: $0 <old flight binary> <new flight binary>"
+    exit 1
+fi
+
+old=$(readlink -f "$1")
+new=$(readlink -f "$2")
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+mkdir "$dir/old" "$dir/new"
+
+status=0
+for state in "0xC4C1F742 0x42C7CD92 -10922 0" "0 0x42C80000 0 0" \
+        "0x44FA0000 0x42700000 0x1000 -0x100" "0xC5000000 0x42A00000 -0x2000 0x200"; do
+    (cd "$dir/old" && "$old" $state > out.txt) || { echo "$old failed on $state"; exit 1; }
+    (cd "$dir/new" && "$new" $state > out.txt) || { echo "$new failed on $state"; exit 1; }
+    for file in out.txt tas_inputs.txt; do
+        if ! cmp -s "$dir/old/$file" "$dir/new/$file"; then
+            echo "$file differs for $state"
+            status=1
+        fi
+    done
+done
+
+if [ $status -eq 0 ]; then
+    echo "Outputs match"
+fi
+exit $status